@@ -0,0 +1,220 @@
+/*======================================================================================================
+ * Module: DIO																							*
+ * File Name: Dio_Bench.c																				*
+ * Description: Cycle benchmark of the DIO Driver APIs, runs on the ATmega32 under simavr.			*
+ *              Every API call is timed with Timer1 running at F_CPU (prescaler 1) and the result	*
+ *              is printed on the simavr console as:												*
+ *              BENCH,<api>,<samples>,<min>,<max>,<mean>   (cycles per call)							*
+ * Author: Mahmoud-Helmy																				*
+ *======================================================================================================*/
+/* =====================================================================================================
+ * 											   INCLUDES
+ * =====================================================================================================*/
+#include "../Dio/Dio.h"
+
+/* Det_ReportError / Det_MainFunction (DIO_DEV_ERROR_DETECT) */
+#include "../Det/Det.h"
+
+/* Dio_PwmInit / Dio_PwmTick (DIO_PWM_API) */
+#include "../Dio/Dio_Pwm.h"
+
+/* simavr ELF section macros (AVR_MCU, AVR_MCU_SIMAVR_CONSOLE) */
+#include <avr/avr_mcu_section.h>
+
+/* =====================================================================================================
+ * 										   DEFINITIONS
+ * =====================================================================================================*/
+#ifndef F_CPU
+#define F_CPU                   (16000000UL)
+#endif
+
+/* Number of timed calls per API */
+#define BENCH_SAMPLES           (64U)
+
+/* Timer1 registers (not taken from <avr/io.h>, its PORTx names clash with MemMap.h) */
+#define BENCH_TCNT1             (*((volatile uint16 *)(0X4C)))
+#define BENCH_TCCR1B            (*((volatile uint8 *)(0X4E)))
+#define BENCH_CS10              (0U)
+
+/* MCU control register, used to stop the simulation */
+#define BENCH_MCUCR             (*((volatile uint8 *)(0X55)))
+#define BENCH_SE                (7U)
+
+/* Register watched by simavr, every byte written to it is printed on the console (TWBR is unused) */
+#define BENCH_CONSOLE           (*((volatile uint8 *)(0X20)))
+
+/* Tell simavr the device, the clock and the console register */
+AVR_MCU(F_CPU, "atmega32");
+AVR_MCU_SIMAVR_CONSOLE(&BENCH_CONSOLE);
+
+/* Statistics of one API */
+typedef struct Bench_ResultType {
+	uint16 Min;
+	uint16 Max;
+	uint32 Sum;
+	uint16 Samples;
+} Bench_ResultType;
+
+/* Cycles of an empty measurement, subtracted from every sample */
+STATIC uint16 Bench_Overhead;
+
+/* Volatile sinks so the compiler cannot drop the read APIs */
+STATIC volatile Dio_LevelType Bench_Level;
+STATIC volatile Dio_PortLevelType Bench_PortLevel;
+
+/* Times one statement with Timer1 */
+#define BENCH_MEASURE(RESULT, STATEMENT) \
+	do { \
+		uint16 Start = BENCH_TCNT1; \
+		STATEMENT; \
+		Bench_Add(&(RESULT), (uint16)(BENCH_TCNT1 - Start)); \
+	} while (0)
+
+/* =====================================================================================================
+ * 							                LOCAL FUNCTIONS
+ * =====================================================================================================*/
+STATIC void Bench_Reset(Bench_ResultType *Result) {
+	Result->Min = 0xFFFFU;
+	Result->Max = 0U;
+	Result->Sum = 0U;
+	Result->Samples = 0U;
+}
+
+STATIC void Bench_Add(Bench_ResultType *Result, uint16 Cycles) {
+	Cycles = (Cycles > Bench_Overhead) ? (uint16)(Cycles - Bench_Overhead) : 0U;
+	if (Cycles < Result->Min) {
+		Result->Min = Cycles;
+	}
+	if (Cycles > Result->Max) {
+		Result->Max = Cycles;
+	}
+	Result->Sum += Cycles;
+	Result->Samples++;
+}
+
+STATIC void Bench_PutString(const char *String) {
+	while (*String != '\0') {
+		BENCH_CONSOLE = (uint8)*String++;
+	}
+}
+
+STATIC void Bench_PutNumber(uint32 Number) {
+	char Digits[11];
+	uint8 Index = sizeof(Digits) - 1U;
+
+	Digits[Index] = '\0';
+	do {
+		Digits[--Index] = (char)('0' + (Number % 10U));
+		Number /= 10U;
+	} while (Number != 0U);
+	Bench_PutString(&Digits[Index]);
+}
+
+STATIC void Bench_Report(const char *Api, const Bench_ResultType *Result) {
+	Bench_PutString("BENCH,");
+	Bench_PutString(Api);
+	BENCH_CONSOLE = ',';
+	Bench_PutNumber(Result->Samples);
+	BENCH_CONSOLE = ',';
+	Bench_PutNumber(Result->Min);
+	BENCH_CONSOLE = ',';
+	Bench_PutNumber(Result->Max);
+	BENCH_CONSOLE = ',';
+	/* Mean rounded to the nearest cycle */
+	Bench_PutNumber((Result->Sum + (Result->Samples / 2U)) / Result->Samples);
+	BENCH_CONSOLE = '\n';
+}
+
+/* =====================================================================================================
+ * 												 MAIN
+ * =====================================================================================================*/
+int main(void) {
+	Bench_ResultType Result;
+	uint16 Sample;
+
+	/* Timer1 counts CPU cycles */
+	BENCH_TCCR1B = (uint8)(1U << BENCH_CS10);
+
+	/* Cost of the measurement itself */
+	Bench_Overhead = 0U;
+	Bench_Reset(&Result);
+	for (Sample = 0U; Sample < BENCH_SAMPLES; ++Sample) {
+		BENCH_MEASURE(Result, (void)0);
+	}
+	Bench_Overhead = Result.Min;
+
+	/* Dio_Init can only run once per reset */
+	Bench_Reset(&Result);
+	BENCH_MEASURE(Result, Dio_Init(&Dio_ConfigurationSet));
+	Bench_Report("Dio_Init", &Result);
+
+	Bench_Reset(&Result);
+	for (Sample = 0U; Sample < BENCH_SAMPLES; ++Sample) {
+		BENCH_MEASURE(Result, Dio_WriteChannel(PORTC_ID, PIN_C_2, (Dio_PinLevelType)(Sample & 1U)));
+	}
+	Bench_Report("Dio_WriteChannel", &Result);
+
+	Bench_Reset(&Result);
+	for (Sample = 0U; Sample < BENCH_SAMPLES; ++Sample) {
+		BENCH_MEASURE(Result, Bench_Level = Dio_ReadChannel(PORTC_ID, PIN_C_2));
+	}
+	Bench_Report("Dio_ReadChannel", &Result);
+
+	Bench_Reset(&Result);
+	for (Sample = 0U; Sample < BENCH_SAMPLES; ++Sample) {
+		BENCH_MEASURE(Result, Dio_WritePort(PORTC_ID, (Dio_PortLevelType)(Sample & 1U)));
+	}
+	Bench_Report("Dio_WritePort", &Result);
+
+#if (DIO_MASKED_WRITE_PORT_API == STD_ON)
+	Bench_Reset(&Result);
+	for (Sample = 0U; Sample < BENCH_SAMPLES; ++Sample) {
+		BENCH_MEASURE(Result, Dio_MaskedWritePort(PORTC_ID, (Dio_PortLevelType)Sample, 0x3FU));
+	}
+	Bench_Report("Dio_MaskedWritePort", &Result);
+#endif
+
+	Bench_Reset(&Result);
+	for (Sample = 0U; Sample < BENCH_SAMPLES; ++Sample) {
+		BENCH_MEASURE(Result, Bench_PortLevel = Dio_ReadPort(PORTC_ID));
+	}
+	Bench_Report("Dio_ReadPort", &Result);
+
+	Bench_Reset(&Result);
+	for (Sample = 0U; Sample < BENCH_SAMPLES; ++Sample) {
+		BENCH_MEASURE(Result, Dio_FlipChannel(PORTC_ID, PIN_C_2));
+	}
+	Bench_Report("Dio_FlipChannel", &Result);
+
+#if (DIO_PWM_API == STD_ON)
+	/* Same cost for one or 32 PWM channels, all the planes of a period are timed */
+	Dio_PwmInit((Dio_ChannelsLevelType)1U << PIN_C_2);
+	(void)Dio_PwmSetDuty(PIN_C_2, (Dio_PwmDutyType)(DIO_PWM_MAX_DUTY / 2U));
+	Dio_PwmUpdate();
+	Bench_Reset(&Result);
+	for (Sample = 0U; Sample < BENCH_SAMPLES; ++Sample) {
+		BENCH_MEASURE(Result, Bench_PortLevel = Dio_PwmTick());
+	}
+	Bench_Report("Dio_PwmTick", &Result);
+#endif
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Cost of an error report (drained after every sample, so always the enqueue path) */
+	Bench_Reset(&Result);
+	for (Sample = 0U; Sample < BENCH_SAMPLES; ++Sample) {
+		BENCH_MEASURE(Result, (void)Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID));
+		Det_MainFunction();
+	}
+	Bench_Report("Det_ReportError", &Result);
+#endif
+
+	Bench_PutString("BENCH,END\n");
+
+	/* Sleeping with interrupts disabled ends the simavr run */
+	__asm__ __volatile__ ("cli");
+	BENCH_MCUCR |= (uint8)(1U << BENCH_SE);
+	for (;;) {
+		__asm__ __volatile__ ("sleep");
+	}
+	return 0;
+}
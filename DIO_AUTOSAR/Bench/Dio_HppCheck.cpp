@@ -0,0 +1,58 @@
+/*======================================================================================================
+ * Module: DIO																							*
+ * File Name: Dio_HppCheck.cpp																			*
+ * Description: Compile-only check of the C++ template layer (Dio.hpp) with avr-g++ ("make devices")	*
+ *              Instantiates Pin / Port / PinGroup on a bit-addressable port (sbi/cbi) and on the	*
+ *              last port of the device (lds/sts on the extended I/O ports of the ATmega2560)		*
+ * Author: Mahmoud-Helmy																				*
+ *======================================================================================================*/
+/* =====================================================================================================
+ * 											   INCLUDES
+ * =====================================================================================================*/
+#include "Dio/Dio.hpp"
+
+/* =====================================================================================================
+ * 										   DEFINITIONS
+ * =====================================================================================================*/
+#define HPP_CHECK_LAST_PORT_ID      ((Dio_PortType)(PORTA_ID + DIO_CONFIGURED_PORTS - 1U))
+
+typedef Dio::Pin<PORTB_ID, PIN3_ID> FirstPin;
+typedef Dio::Port<PORTB_ID> FirstPort;
+typedef Dio::PinGroup<PORTB_ID, 0x3CU, 2U> FirstGroup;
+
+typedef Dio::Pin<HPP_CHECK_LAST_PORT_ID, PIN6_ID> LastPin;
+typedef Dio::Port<HPP_CHECK_LAST_PORT_ID> LastPort;
+typedef Dio::PinGroup<HPP_CHECK_LAST_PORT_ID, 0xF0U, 4U> LastGroup;
+
+/* =====================================================================================================
+ * 										  FUNCTIONS
+ * =====================================================================================================*/
+/* Every member of the templates, with external linkage so each one is kept in dio.lss */
+template <typename PinT, typename PortT, typename GroupT>
+static Dio_PortLevelType Dio_HppCheckPort(void) {
+	PinT::SetOutput();
+	PinT::Set();
+	PinT::Clear();
+	PinT::Write(PinT::Toggle());
+	PinT::SetInput();
+	PinT::Init();
+
+	PortT::SetDirection(0xFFU);
+	PortT::Write(0x5AU);
+	PortT::Write(0xF0U, 0x3CU);
+
+	GroupT::Write(0x05U);
+#if (DIO_HPP_CONFIG_IN_FLASH == STD_OFF)
+	/* ODR-use of the constexpr descriptor, needs its out-of-class definition in C++11 */
+	Dio_WriteChannelGroup(&GroupT::Descriptor, GroupT::Read());
+#endif
+	return (Dio_PortLevelType)(PortT::Read() ^ GroupT::Read() ^ PinT::Read());
+}
+
+extern "C" Dio_PortLevelType Dio_HppCheckFirstPort(void) {
+	return Dio_HppCheckPort<FirstPin, FirstPort, FirstGroup>();
+}
+
+extern "C" Dio_PortLevelType Dio_HppCheckLastPort(void) {
+	return Dio_HppCheckPort<LastPin, LastPort, LastGroup>();
+}
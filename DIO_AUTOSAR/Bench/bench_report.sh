@@ -0,0 +1,19 @@
+#!/bin/sh
+################################################################################
+# Collects the BENCH lines of the simavr logs into one CSV report.
+# The variant is taken from the log name: bench-<opt>-<det>.log
+#
+#   ./bench_report.sh build/bench-*.log > report.csv
+################################################################################
+echo "opt,det,api,samples,min,max,mean"
+for log in "$@"; do
+	variant=$(basename "$log" .log)
+	variant=${variant#bench-}
+	opt=${variant%%-*}
+	det=${variant#*-}
+	if ! grep -q "BENCH,END" "$log"; then
+		echo "$log: benchmark did not complete" >&2
+		exit 1
+	fi
+	grep -o "BENCH,[A-Za-z0-9_]*,[0-9,]*" "$log" | sed "s/^BENCH,/$opt,$det,/"
+done
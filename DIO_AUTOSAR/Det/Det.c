@@ -1,24 +1,171 @@
 /*===============================================================================
- * Module: Det																	*															
- * File Name: Det.c																*																
+ * Module: Det																	*
+ * File Name: Det.c																*
  * Description: Det stores the development errors reported by other modules.    *
  *              This source file is a STUB for the Det Module					*
  * Author: Mahmoud-Helmy														*
  *==============================================================================*/
 #include "Det.h"
 
+/* Interrupt lock of the ring: Det_ReportError may be called from an ISR */
+#if defined(__AVR__)
+#define DET_SREG                      (*((volatile uint8 *)(0X5F)))
+#define SchM_Enter_Det_Ring() \
+    do { \
+        uint8 Det_SavedSreg = DET_SREG; \
+        __asm__ __volatile__ ("cli" : : : "memory")
+#define SchM_Exit_Det_Ring() \
+        DET_SREG = Det_SavedSreg; \
+        __asm__ __volatile__ ("" : : : "memory"); \
+    } while (0)
+#else
+/* Host build: single threaded, no interrupts */
+#define SchM_Enter_Det_Ring()         do {
+#define SchM_Exit_Det_Ring()          } while (0)
+#endif
+
+/* Ring slot of a free running record index */
+#define DET_RING_SLOT(INDEX)          ((uint8)((INDEX) & (DET_RING_SIZE - 1U)))
+
+/* Saturating increment of an 8 bit counter */
+#define DET_SATURATED_INC(COUNTER)    do { if ((COUNTER) < 0xFFU) { (COUNTER)++; } } while (0)
+
+/* Counter of one (module, API, error) */
+typedef struct Det_ErrorCounterType {
+    uint16 ModuleId;
+    uint8 ApiId;
+    uint8 ErrorId;
+    uint8 Count;
+} Det_ErrorCounterType;
+
 /* Variables to store last DET error */
 uint16 Det_ModuleId = 0;       /*DET module ID*/
 uint8 Det_InstanceId = 0;      /*DET instance ID*/
 uint8 Det_ApiId = 0;           /* DET API ID*/
 uint8 Det_ErrorId = 0;         /* DET Error ID*/
 
+uint8 Det_LostErrors = 0;      /* Errors dropped, ring full */
+uint8 Det_UncountedErrors = 0; /* Errors not counted, no free counter */
+
+/* Ring of the last errors, written at Det_RingHead by Det_ReportError and processed up to
+ * Det_RingTail by Det_MainFunction (free running indexes, one byte so read atomically) */
+static Det_ErrorRecordType Det_Ring[DET_RING_SIZE];
+static volatile uint8 Det_RingHead = 0;
+static volatile uint8 Det_RingTail = 0;
+
+/* Number of valid records in the ring, processed or not (saturates at DET_RING_SIZE) */
+static volatile uint8 Det_RingFill = 0;
+
+/* Counters, taken in the order the errors are first seen */
+static Det_ErrorCounterType Det_Counters[DET_COUNTER_SLOTS];
+static uint8 Det_CountersUsed = 0;
+
+void Det_Init( void )
+{
+    SchM_Enter_Det_Ring();
+    Det_RingHead = 0;
+    Det_RingTail = 0;
+    Det_RingFill = 0;
+    Det_LostErrors = 0;
+    SchM_Exit_Det_Ring();
+
+    Det_CountersUsed = 0;
+    Det_UncountedErrors = 0;
+    Det_ModuleId = 0;
+    Det_InstanceId = 0;
+    Det_ApiId = 0;
+    Det_ErrorId = 0;
+}
+
 Std_ReturnType Det_ReportError( uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId )
 {
-    Det_ModuleId = ModuleId; 
+    SchM_Enter_Det_Ring();
+    Det_ModuleId = ModuleId;
     Det_InstanceId = InstanceId;
-    Det_ApiId = ApiId; 
+    Det_ApiId = ApiId;
     Det_ErrorId = ErrorId;
+
+    /* Unprocessed records are never overwritten, the counters would miss them */
+    if ((uint8)(Det_RingHead - Det_RingTail) < DET_RING_SIZE) {
+        Det_ErrorRecordType *Record = &Det_Ring[DET_RING_SLOT(Det_RingHead)];
+
+        Record->ModuleId = ModuleId;
+        Record->InstanceId = InstanceId;
+        Record->ApiId = ApiId;
+        Record->ErrorId = ErrorId;
+        Det_RingHead++;
+        if (Det_RingFill < DET_RING_SIZE) {
+            Det_RingFill++;
+        }
+    } else {
+        DET_SATURATED_INC(Det_LostErrors);
+    }
+    SchM_Exit_Det_Ring();
     return E_OK;
 }
 
+void Det_MainFunction( void )
+{
+    uint8 Head = Det_RingHead;
+    uint8 Tail = Det_RingTail;
+
+    /* Records in [Tail, Head) are not touched by Det_ReportError */
+    while (Tail != Head) {
+        const Det_ErrorRecordType *Record = &Det_Ring[DET_RING_SLOT(Tail)];
+        uint8 Slot;
+
+        for (Slot = 0; Slot < Det_CountersUsed; ++Slot) {
+            if ((Det_Counters[Slot].ModuleId == Record->ModuleId)
+             && (Det_Counters[Slot].ApiId == Record->ApiId)
+             && (Det_Counters[Slot].ErrorId == Record->ErrorId)) {
+                break;
+            }
+        }
+
+        if (Slot < Det_CountersUsed) {
+            DET_SATURATED_INC(Det_Counters[Slot].Count);
+        } else if (Det_CountersUsed < DET_COUNTER_SLOTS) {
+            Det_Counters[Slot].ModuleId = Record->ModuleId;
+            Det_Counters[Slot].ApiId = Record->ApiId;
+            Det_Counters[Slot].ErrorId = Record->ErrorId;
+            Det_Counters[Slot].Count = 1U;
+            Det_CountersUsed++;
+        } else {
+            DET_SATURATED_INC(Det_UncountedErrors);
+        }
+
+        /* Frees the slot for Det_ReportError */
+        Det_RingTail = ++Tail;
+    }
+}
+
+uint8 Det_GetErrorCount( uint16 ModuleId, uint8 ApiId, uint8 ErrorId )
+{
+    uint8 Count = 0;
+
+    for (uint8 Slot = 0; Slot < Det_CountersUsed; ++Slot) {
+        if ((Det_Counters[Slot].ModuleId == ModuleId)
+         && (Det_Counters[Slot].ApiId == ApiId)
+         && (Det_Counters[Slot].ErrorId == ErrorId)) {
+            Count = Det_Counters[Slot].Count;
+            break;
+        }
+    }
+    return Count;
+}
+
+Std_ReturnType Det_GetErrorRecord( uint8 Age, Det_ErrorRecordType *Record )
+{
+    Std_ReturnType Result = E_NOT_OK;
+
+    if (NULL_PTR != Record) {
+        /* A processed record may be overwritten by an ISR while it is copied */
+        SchM_Enter_Det_Ring();
+        if (Age < Det_RingFill) {
+            *Record = Det_Ring[DET_RING_SLOT((uint8)(Det_RingHead - 1U - Age))];
+            Result = E_OK;
+        }
+        SchM_Exit_Det_Ring();
+    }
+    return Result;
+}
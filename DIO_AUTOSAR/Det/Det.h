@@ -42,6 +42,34 @@
   #error "The AR version of Std_Types.h does not match the expected version"
 #endif
 
+/*******************************************************************************
+ *                      Configuration                                          *
+ *******************************************************************************/
+/* Number of error records kept by Det_ReportError (power of 2, 2 .. 128) */
+#ifndef DET_RING_SIZE
+#define DET_RING_SIZE                 (8U)
+#endif
+
+/* Number of different (module, API, error) counters of Det_MainFunction */
+#ifndef DET_COUNTER_SLOTS
+#define DET_COUNTER_SLOTS             (16U)
+#endif
+
+#if ((DET_RING_SIZE < 2U) || (DET_RING_SIZE > 128U) || ((DET_RING_SIZE & (DET_RING_SIZE - 1U)) != 0U))
+  #error "DET_RING_SIZE shall be a power of 2 within 2 .. 128"
+#endif
+
+/*******************************************************************************
+ *                      Types                                                  *
+ *******************************************************************************/
+/* One reported development error */
+typedef struct Det_ErrorRecordType {
+    uint16 ModuleId;
+    uint8 InstanceId;
+    uint8 ApiId;
+    uint8 ErrorId;
+} Det_ErrorRecordType;
+
 /*******************************************************************************
  *                      External Variables                                     *
  *******************************************************************************/   
@@ -50,9 +78,40 @@ extern uint8 Det_InstanceId;      /*DET instance ID*/
 extern uint8 Det_ApiId;           /* DET API ID*/
 extern uint8 Det_ErrorId;         /* DET Error ID*/
 
+/* Errors dropped because the ring was full of unprocessed records (saturates at 255) */
+extern uint8 Det_LostErrors;
+
+/* Errors not counted because all the DET_COUNTER_SLOTS were taken (saturates at 255) */
+extern uint8 Det_UncountedErrors;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+/* Clears the records, the counters and the last error */
+void Det_Init( void );
+
+/*
+ * Stores the error in the ring and as the last error. Safe to call from an ISR and
+ * bounded: a few byte stores inside a short interrupt lock, no search, no loop (estimated
+ * at about 40 cycles with the call on the ATmega32, not measured: the Bench build reports
+ * it as Det_ReportError). When the ring is full
+ * of records not yet processed by Det_MainFunction the error is only counted as lost.
+ */
 Std_ReturnType Det_ReportError( uint16 ModuleId,
                       uint8 InstanceId,
                       uint8 ApiId,
 		      uint8 ErrorId );
 
+/* Cyclic function: adds the new records to the saturating per-(module, API, error) counters */
+void Det_MainFunction( void );
+
+/* Number of (ModuleId, ApiId, ErrorId) errors processed so far, saturates at 255 */
+uint8 Det_GetErrorCount( uint16 ModuleId, uint8 ApiId, uint8 ErrorId );
+
+/*
+ * Copies a record of the ring, Age 0 = newest. Returns E_NOT_OK if fewer than Age + 1
+ * errors are kept (at most DET_RING_SIZE, processed or not).
+ */
+Std_ReturnType Det_GetErrorRecord( uint8 Age, Det_ErrorRecordType *Record );
+
 #endif /* DET_H */
@@ -9,6 +9,8 @@
  * =============================================================================*/
 #include "Dio.h"
 #include "MemMap.h"
+#include "SchM_Dio.h"
+#include "Dio_Trace.h"
 
 /* =============================================================================
  * 								VERSION CHECK
@@ -35,50 +37,342 @@
  * 							 GLOBAL VARIABLES
  * ==============================================================================================================*/
 /* @struct Dio_ConfigType: * This structure defines the configuration for the DIO module. 
- *						   * It contains an array of pointers to Dio_ConfigPin structures.
- * @member channels[DIO_CONFIGURED_CHANNLES]: * This array holds pointers to individual pin configurations. 
- *										  * The size of the array is DIO_CONFIGURED_CHANNLES, 
- *											which represents the number of configured channels.
+ *						   * It contains one bit packed Dio_PortConfigType per port (4 bytes each).
+ *						   * With DIO_CONFIG_IN_FLASH it stays in flash and is read through a __flash pointer.
+ * @member ports[DIO_CONFIGURED_PORTS]: * Indexed by (Port_Id - PORTA_ID).
+ * @member Notification: * Rising / falling edge masks per port and table of the notified channels (DIO_NOTIFICATION_API).
  *
- * @struct Dio_ConfigPin: This structure represents the configuration of an individual pin within the DIO module.
- * @member Port_Id: This member stores the ID of the port to which the pin belongs. 
- * @member Pin_Id: This member stores the ID of the pin.
- * @member dir: This member indicates the direction of the pin, whether it's an input or an output.
- * @member level: This member indicates the initial level (high or low) of the pin.
+ * @struct Dio_PortConfigType: This structure represents the configuration of the pins of one port, bit n = PINn.
+ * @member Configured: This member marks the pins configured by the DIO module.
+ * @member Direction: This member indicates the direction of the pins, 1 = output, 0 = input.
+ * @member Level: This member indicates the initial level (high or low) of the output pins.
+ * @member PullUp: This member enables the internal pull-up of the input pins.
  
  
  * This is a static pointer to a constant Dio_ConfigType structure. 
  * It will be used to store the configuration data for the DIO module.
  */
-STATIC const Dio_ConfigType *Dio_PortChannels = NULL_PTR;
+STATIC DIO_CONFIG_CONST Dio_ConfigType *Dio_PortChannels = NULL_PTR;
 
 /* This is a static variable that keeps track of the initialization status of the DIO module. 
  * It's initialized to DIO_NOT_INITIALIZED
  */
 STATIC uint8 Dio_Status = DIO_NOT_INITIALIZED;
 
+/* Input snapshot of the last Dio_SampleInputs call */
+STATIC Dio_InputSnapshotType Dio_InputSnapshot;
+
+#if (DIO_DEBOUNCE_API == STD_ON)
+/* @struct Dio_DebounceType: Debouncer state of all the channels, one byte per port (bit n = PINn).
+ * @member State: Debounced level of the channels.
+ * @member Count: Vertical counters, Count[b] holds bit b of the counter of every channel.
+ *                A channel counter is the number of consecutive samples that differed from State.
+ */
+typedef struct Dio_DebounceType {
+	Dio_InputSnapshotType State;
+	uint8 Count[DIO_DEBOUNCE_COUNTER_BITS][DIO_IMAGE_PORTS];
+} Dio_DebounceType;
+
+STATIC Dio_DebounceType Dio_Debounce;
+#endif
+
+#if (DIO_NOTIFICATION_API == STD_ON)
+/* Levels seen by the previous edge notification pass */
+STATIC Dio_InputSnapshotType Dio_NotifyPrevious;
+#endif
+
+/* Port index of a channel index of Dio_ChannelMap */
+#define DIO_CHANNEL_PORT_INDEX(INDEX)                  ((uint8)((INDEX) / NUM_OF_PINS_IN_SINGLE_PORT))
+
+#if (DIO_DEFERRED_WRITE == STD_ON)
+/* RAM images of the PORT registers written by the output APIs, indexed by (Port_Id - PORTA_ID) */
+STATIC uint8 Dio_OutputShadow[DIO_CONFIGURED_PORTS];
+
+/* Ports whose shadow differs from the register, indexed by (Port_Id - PORTA_ID), cleared by
+ * Dio_CommitOutputs. One byte per port, so marking a port is a single constant store inside the
+ * exclusive area of the write APIs (no variable shift, no read-modify-write of a bit mask) */
+STATIC boolean Dio_DirtyPorts[DIO_CONFIGURED_PORTS];
+
+/* Output latch access of the output APIs: the shadow of the port, pushed by Dio_CommitOutputs */
+#define DIO_OUTPUT_READ(PORT_INDEX, PORT_PTR)          (Dio_OutputShadow[(PORT_INDEX)])
+#define DIO_OUTPUT_WRITE(PORT_INDEX, PORT_PTR, VALUE) \
+	do { \
+		(void)(PORT_PTR); \
+		Dio_OutputShadow[(PORT_INDEX)] = (VALUE); \
+		Dio_DirtyPorts[(PORT_INDEX)] = TRUE; \
+	} while (0)
+#else
+/* Output latch access of the output APIs: the PORT register itself */
+#define DIO_OUTPUT_READ(PORT_INDEX, PORT_PTR)          DIO_REG_READ(PORT_PTR)
+#define DIO_OUTPUT_WRITE(PORT_INDEX, PORT_PTR, VALUE)  DIO_REG_WRITE((PORT_PTR), (VALUE))
+#endif
+
+#if (DIO_PROFILING == STD_ON)
+/* Statistics of the services, indexed by their DIO_*_SID */
+STATIC Dio_ServiceStatisticsType Dio_Statistics[DIO_PROFILING_SERVICES];
+
+/* Saturating increment of a statistics counter */
+#define DIO_STATISTICS_INC(COUNTER) \
+	do { \
+		if ((COUNTER) < 0xFFFFU) { \
+			(COUNTER)++; \
+		} \
+	} while (0)
+
+/* Time stamp at the entry of a service, statistics update at the exit (Dio_ClockRead in SchM_Dio.h) */
+#define DIO_PROFILE_ENTER(SID)                         uint16 Dio_ServiceStart = Dio_ClockRead();
+#define DIO_PROFILE_EXIT(SID, ERROR)                   Dio_ProfileService((SID), (ERROR), Dio_ServiceStart);
+#else
+/* Profiling disabled: no code, no data */
+#define DIO_PROFILE_ENTER(SID)
+#define DIO_PROFILE_EXIT(SID, ERROR)
+#endif
+
+/* Entry / exit hooks of every service: statistics (DIO_PROFILING) and service ID of the trace
+ * records (DIO_TRACE, Dio_Trace.h), both compiled out when disabled */
+#define DIO_SERVICE_ENTER(SID)                         DIO_PROFILE_ENTER(SID) DIO_TRACE_ENTER(SID)
+#define DIO_SERVICE_EXIT(SID, ERROR)                   DIO_TRACE_EXIT() DIO_PROFILE_EXIT(SID, ERROR)
+
+
+/* @struct Dio_ChannelMapType: Register addresses and bit mask of a single DIO channel.
+ * @member Port: Address of the PORTx (output latch) register of the channel.
+ * @member Pin: Address of the PINx (input) register of the channel.
+ * @member Ddr: Address of the DDRx (direction) register of the channel.
+ * @member Mask: Bit mask of the channel inside the three registers.
+ */
+typedef struct Dio_ChannelMapType {
+	volatile uint8 *Port;
+	volatile uint8 *Pin;
+	volatile uint8 *Ddr;
+	uint8 Mask;
+} Dio_ChannelMapType;
+
+#define DIO_CHANNEL_MAP(PORT_REG, PIN_REG, DDR_REG, BIT) \
+	{ &(PORT_REG), &(PIN_REG), &(DDR_REG), (uint8)(1U << (BIT)) }
+
+/* The 8 channels of a port of the device table (DIO_DEVICE_PORTS, MemMap.h) */
+#define DIO_CHANNEL_MAP_PORT(ARG, L) \
+	DIO_CHANNEL_MAP(PORT##L, PIN##L, DDR##L, PIN0), \
+	DIO_CHANNEL_MAP(PORT##L, PIN##L, DDR##L, PIN1), \
+	DIO_CHANNEL_MAP(PORT##L, PIN##L, DDR##L, PIN2), \
+	DIO_CHANNEL_MAP(PORT##L, PIN##L, DDR##L, PIN3), \
+	DIO_CHANNEL_MAP(PORT##L, PIN##L, DDR##L, PIN4), \
+	DIO_CHANNEL_MAP(PORT##L, PIN##L, DDR##L, PIN5), \
+	DIO_CHANNEL_MAP(PORT##L, PIN##L, DDR##L, PIN6), \
+	DIO_CHANNEL_MAP(PORT##L, PIN##L, DDR##L, PIN7),
+
+/* Channel lookup table indexed by Dio_ChannelType (PIN_A_0 .. last pin of the device).
+ * It lives in flash so each API only pays a table load instead of a switch on the port
+ * and a modulo on the channel before touching the register.
+ */
+STATIC const FLASH Dio_ChannelMapType Dio_ChannelMap[DIO_TOTAL_CHANNLES] = {
+	DIO_DEVICE_PORTS(DIO_CHANNEL_MAP_PORT, ~)
+};
+
+/* @struct Dio_PortMapType: Register addresses of a single DIO port.
+ * @member Port: Address of the PORTx (output latch) register of the port.
+ * @member Pin: Address of the PINx (input) register of the port.
+ * @member Ddr: Address of the DDRx (direction) register of the port.
+ */
+typedef struct Dio_PortMapType {
+	volatile uint8 *Port;
+	volatile uint8 *Pin;
+	volatile uint8 *Ddr;
+} Dio_PortMapType;
+
+#define DIO_PORT_MAP_ENTRY(ARG, L)                     { &PORT##L, &PIN##L, &DDR##L },
+
+/* Port lookup table indexed by (Port_Id - PORTA_ID), one entry per port of the device */
+STATIC const FLASH Dio_PortMapType Dio_PortMap[DIO_CONFIGURED_PORTS] = {
+	DIO_DEVICE_PORTS(DIO_PORT_MAP_ENTRY, ~)
+};
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+/* Pins bonded out on each port of the device (bit n = PINn), indexed by (Port_Id - PORTA_ID) */
+STATIC const FLASH uint8 Dio_BondedPins[DIO_CONFIGURED_PORTS] = DIO_DEVICE_BONDED_PINS;
 
 /**
- * @brief Extracts the pin number from the given ChannelId.
- * @param ChannelId The ID of the pin.
- * @return The extracted pin number.
- *
- * This function extracts the pin number from the given ChannelId based on certain conditions.
+ * @brief Development error check of the Channel_Id of the port based channel APIs.
+ * @param Port_Id The ID of the port (PORTA_ID .. last port of the device).
+ * @param ChannelId The ID of the pin, either local to the port (PIN0_ID) or global (PIN_C_0).
+ * @return TRUE if the channel ID is in range and its pin is bonded out on a valid port.
+ */
+LOCAL_INLINE boolean isChannelValid(Dio_PortType Port_Id, Dio_ChannelType ChannelId) {
+	uint8 PortIndex = (uint8)(Port_Id - PORTA_ID);
+	boolean Valid = FALSE;
+
+	if (ChannelId < DIO_CONFIGURED_CHANNLES) {
+		if (PortIndex < DIO_CONFIGURED_PORTS) {
+			Valid = ((Dio_BondedPins[PortIndex] & DIO_CHANNEL_BIT(ChannelId)) != 0U) ? TRUE : FALSE;
+		} else {
+			/* The port is not checked here, the API ignores an invalid port */
+			Valid = TRUE;
+		}
+	} else {
+		/* Do Nothing */
+	}
+	return Valid;
+}
+#endif
+
+/**
+ * @brief Maps a Port_Id / Channel_Id pair to its index in Dio_ChannelMap.
+ * @param Port_Id The ID of the port (PORTA_ID .. last port of the device).
+ * @param ChannelId The ID of the pin, either local to the port (PIN0_ID) or global (PIN_C_0).
+ * @return The channel index, or DIO_TOTAL_CHANNLES if the port is not valid.
+ */
+LOCAL_INLINE uint8 getChannelIndex(Dio_PortType Port_Id, Dio_ChannelType ChannelId) {
+	uint8 PortIndex = (uint8)(Port_Id - PORTA_ID);
+	uint8 Index = DIO_TOTAL_CHANNLES;
+
+	if (PortIndex < DIO_CONFIGURED_PORTS) {
+		Index = (uint8)((PortIndex * NUM_OF_PINS_IN_SINGLE_PORT) + (ChannelId % NUM_OF_PINS_IN_SINGLE_PORT));
+	} else {
+		/* Do Nothing */
+	}
+	return Index;
+}
+
+/**
+ * @brief Reads PINA .. PIND back to back, then stores them into a snapshot.
+ * @param Snapshot The snapshot to be filled.
+ */
+LOCAL_INLINE void Dio_LatchInputs(Dio_InputSnapshotType *Snapshot) {
+	/* Four consecutive register loads first (at most 3 cycles between the first and the last
+	 * sample, counted from the instruction timings), then byte stores without any shifting */
+	uint8 LevelA = DIO_REG_READ(&PINA);
+	uint8 LevelB = DIO_REG_READ(&PINB);
+	uint8 LevelC = DIO_REG_READ(&PINC);
+	uint8 LevelD = DIO_REG_READ(&PIND);
+
+	Snapshot->Ports[PORTA_ID - PORTA_ID] = LevelA;
+	Snapshot->Ports[PORTB_ID - PORTA_ID] = LevelB;
+	Snapshot->Ports[PORTC_ID - PORTA_ID] = LevelC;
+	Snapshot->Ports[PORTD_ID - PORTA_ID] = LevelD;
+}
+
+#if (DIO_DEBOUNCE_API == STD_ON)
+/**
+ * @brief Debounces all the channels against a new sample. A channel takes a new debounced
+ *        level after DIO_DEBOUNCE_SAMPLES consecutive samples at that level.
+ *        The 8 channels of a port are handled together with vertical counters (one byte
+ *        per counter bit), so the cost depends on the number of ports only.
+ * @param Sample The levels just latched from the PIN registers.
+ */
+LOCAL_INLINE void Dio_DebounceInputs(const Dio_InputSnapshotType *Sample) {
+	for (uint8 PortIndex = 0; PortIndex < DIO_IMAGE_PORTS; ++PortIndex) {
+		/* Channels whose sample differs from their debounced level */
+		uint8 Delta = (uint8)(Sample->Ports[PortIndex] ^ Dio_Debounce.State.Ports[PortIndex]);
+		/* Channels whose counter already holds (DIO_DEBOUNCE_SAMPLES - 1): this is the
+		 * last sample needed, the comparison with the constant folds at compile time */
+		uint8 Accepted = Delta;
+		/* Counters that keep running: differing channels that are not accepted yet */
+		uint8 Running;
+		uint8 Carry = Delta;
+
+		for (uint8 Bit = 0; Bit < DIO_DEBOUNCE_COUNTER_BITS; ++Bit) {
+			if ((((DIO_DEBOUNCE_SAMPLES - 1U) >> Bit) & 1U) != 0U) {
+				Accepted &= Dio_Debounce.Count[Bit][PortIndex];
+			} else {
+				Accepted &= (uint8)(~Dio_Debounce.Count[Bit][PortIndex]);
+			}
+		}
+		Running = (uint8)(Delta & (uint8)(~Accepted));
+
+		/* Increment the running counters (ripple carry across the bit planes), clear the others */
+		for (uint8 Bit = 0; Bit < DIO_DEBOUNCE_COUNTER_BITS; ++Bit) {
+			uint8 Plane = Dio_Debounce.Count[Bit][PortIndex];
+
+			Dio_Debounce.Count[Bit][PortIndex] = (uint8)((Plane ^ Carry) & Running);
+			Carry &= Plane;
+		}
+		/* Accepted channels take their new level (and restart from a cleared counter) */
+		Dio_Debounce.State.Ports[PortIndex] ^= Accepted;
+	}
+}
+#endif
+
+#if (DIO_NOTIFICATION_API == STD_ON)
+/**
+ * @brief Calls the configured edge notifications of the channels that changed since the
+ *        previous call. A port without any notified edge costs an xor and two ands; the
+ *        table of the notified channels is only walked when one of them made its edge.
+ * @param Levels The current levels (sampled or debounced).
+ */
+STATIC void Dio_NotifyChanges(const Dio_InputSnapshotType *Levels) {
+	uint8 Pending[DIO_IMAGE_PORTS];
+	uint8 Any = 0U;
+
+	for (uint8 PortIndex = 0; PortIndex < DIO_IMAGE_PORTS; ++PortIndex) {
+		uint8 Now = Levels->Ports[PortIndex];
+		uint8 Changed = (uint8)(Now ^ Dio_NotifyPrevious.Ports[PortIndex]);
+
+		/* Changed channels notified on the edge they just made */
+		Pending[PortIndex] = (uint8)(Changed & ((Now & Dio_PortChannels->Notification.Rising[PortIndex])
+				| ((uint8)(~Now) & Dio_PortChannels->Notification.Falling[PortIndex])));
+		Any |= Pending[PortIndex];
+
+		Dio_NotifyPrevious.Ports[PortIndex] = Now;
+	}
+
+	if (Any != 0U) {
+		DIO_CONFIG_CONST Dio_ChannelNotificationType *Entry = Dio_PortChannels->Notification.Channels;
+		uint8 Count = Dio_PortChannels->Notification.Count;
+
+		/* Sorted by channel ID, so the callbacks are called in channel order */
+		for (uint8 Index = 0; Index < Count; ++Index) {
+			Dio_ChannelType Channel_Id = Entry[Index].Channel;
+			uint8 PortIndex = DIO_CHANNEL_PORT_INDEX(Channel_Id);
+			uint8 Mask = DIO_CHANNEL_BIT(Channel_Id);
+
+			if ((Pending[PortIndex] & Mask) != 0U) {
+				Entry[Index].Callback(Channel_Id, (Dio_LevelType)(((Levels->Ports[PortIndex] & Mask) != 0U) ? STD_HIGH : STD_LOW));
+			} else {
+				/* Do Nothing */
+			}
+		}
+	} else {
+		/* Do Nothing */
+	}
+}
+#endif
+
+#if (DIO_PROFILING == STD_ON)
+/**
+ * @brief Adds one call to the statistics of a service.
+ * @param ServiceId The DIO_*_SID of the service.
+ * @param Error TRUE if the call was rejected.
+ * @param Start Dio_ClockRead() at the entry of the service.
  */
-STATIC uint8 getChannelNum(Dio_ChannelType ChannelId) {
-    if (ChannelId <= 7) {
-        /*If ChannelId is 7 or less, return it as the pin number*/
-        return ChannelId;
-
-    } else if (ChannelId > 7) {
-        /*If ChannelId is greater than 7, calculate the pin number using modulo*/
-        return ChannelId % NUM_OF_PINS_IN_SINGLE_PORT;
-    } else {
-        /* Do Nothing */
-    }
-    /* Return the ChannelId in case no condition is met*/
-    return ChannelId;
+STATIC void Dio_ProfileService(uint8 ServiceId, boolean Error, uint16 Start) {
+	uint16 Ticks = (uint16)(Dio_ClockRead() - Start);
+	uint16 Limit = DIO_PROFILING_BIN0_TICKS;
+	uint8 Bin = 0U;
+	Dio_ServiceStatisticsType *Statistics = &Dio_Statistics[ServiceId];
+
+	/* Histogram bin outside of the lock */
+	while ((Bin < (DIO_PROFILING_BINS - 1U)) && (Ticks >= Limit)) {
+		++Bin;
+		Limit <<= 1;
+	}
+
+	/* The services may also be called from ISRs */
+	SchM_Enter_Dio_PortAccess();
+	DIO_STATISTICS_INC(Statistics->Calls);
+	if (FALSE != Error) {
+		DIO_STATISTICS_INC(Statistics->Errors);
+	} else {
+		/* Do Nothing */
+	}
+	if (Ticks > Statistics->MaxTicks) {
+		Statistics->MaxTicks = Ticks;
+	} else {
+		/* Do Nothing */
+	}
+	DIO_STATISTICS_INC(Statistics->Histogram[Bin]);
+	SchM_Exit_Dio_PortAccess();
 }
+#endif
 
 /* ==============================================================================================================
  * 												 APIs
@@ -95,7 +389,8 @@ STATIC uint8 getChannelNum(Dio_ChannelType ChannelId) {
  * Return value: None
  * Description: Function to Initialize the Dio module.
  *===================================================================================*/
-void Dio_Init(const Dio_ConfigType *ConfigPtr) {
+void Dio_Init(DIO_CONFIG_CONST Dio_ConfigType *ConfigPtr) {
+	DIO_SERVICE_ENTER(DIO_INIT_SID);
 /*If it's defined as STD_ON, error detection is enabled.*/
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
 	/* check if the input configuration pointer is a NULL_PTR 
@@ -109,63 +404,60 @@ void Dio_Init(const Dio_ConfigType *ConfigPtr) {
 		if (DIO_NOT_INITIALIZED == Dio_Status) {
 			Dio_Status = DIO_INITIALIZED;
 			Dio_PortChannels = ConfigPtr;
-			uint8 ChannelNum;
-			/* store the pointer to the relevant PORT register.
-			 * by using the volatile keyword, you ensure that the compiler treats the Port_Ptr pointer as potentially changing its value at any time, 
-			 * which is essential when dealing with memory-mapped hardware registers that can be modified by external factors. 
-			 * This helps prevent unexpected behavior and ensures accurate interaction with hardware peripherals.*/
-			volatile uint8 *Port_Ptr = NULL_PTR;
-
-			/* Point to the correct PORT register according to the Port Id stored in the Port_Id member */
-			for (uint8 i = 0; i < DIO_CONFIGURED_CHANNLES; ++i) {
-				if (Dio_PortChannels->channels[i] == NULL_PTR) {
-					/* Do Nothing */
-					} else {
-					/* Assigns the appropriate address of the PORT register to the Port_Ptr variable.*/
-					switch (Dio_PortChannels->channels[i]->Port_Id) {
-					case (PORTA_ID):
-						Port_Ptr = &PORTA;
-						break;
-					case (PORTB_ID):
-						Port_Ptr = &PORTB;
-						break;
-					case (PORTC_ID):
-						Port_Ptr = &PORTC;
-						break;
-					case (PORTD_ID):
-						Port_Ptr = &PORTD;
-						break;
-					}
-
-					ChannelNum = getChannelNum(Dio_PortChannels->channels[i]->Pin_Id);
-					/* Ensuring that a valid PORT register has been determined.*/
-					if (Port_Ptr != NULL_PTR) {
-						/*Set Pin Direction*/
-						if (Dio_PortChannels->channels[i]->dir == INPUT) {
-							SET_BIT(*Port_Ptr, ChannelNum);
-						} else if (Dio_PortChannels->channels[i]->dir == OUTPUT) {
-							CLEAR_BIT(*Port_Ptr, ChannelNum);
-						} else {
-							/* Do Nothing (there's no configuration for this pin, so no action is taken) */
-						}
-
-						/*Set Pin Value*/
-						if (Dio_PortChannels->channels[i]->level == STD_HIGH) {
-							SET_BIT(*Port_Ptr, ChannelNum);
-						} else if (Dio_PortChannels->channels[i]->level == STD_LOW) {
-							CLEAR_BIT(*Port_Ptr, ChannelNum);
-						} else {
-							/* Do Nothing */
-						}
-					} else {
-						/* Do Nothing */
-					}
+
+			/* Apply the precomputed images port by port: one PORT write then one DDR write.
+			 * The PORT latch is written first so every output starts driving at its
+			 * configured level, without a glitch through the reset level.
+			 */
+			for (uint8 PortIndex = 0; PortIndex < DIO_CONFIGURED_PORTS; ++PortIndex) {
+				uint8 Mask = Dio_PortChannels->ports[PortIndex].Configured;
+
+				if (Mask != 0U) {
+					volatile uint8 *Port_Ptr = Dio_PortMap[PortIndex].Port;
+					volatile uint8 *Ddr_Ptr = Dio_PortMap[PortIndex].Ddr;
+					uint8 Direction = Dio_PortChannels->ports[PortIndex].Direction;
+					/* The PORT latch holds the level of the outputs and the pull-up of the inputs */
+					uint8 Latch = (uint8)((Dio_PortChannels->ports[PortIndex].Level & Direction)
+							| (Dio_PortChannels->ports[PortIndex].PullUp & (uint8)(~Direction)));
+
+					/*Set Pins Value*/
+					SchM_Enter_Dio_PortAccess();
+					DIO_REG_WRITE(Port_Ptr, (uint8)((DIO_REG_READ(Port_Ptr) & (uint8)(~Mask)) | (Latch & Mask)));
+					SchM_Exit_Dio_PortAccess();
+					/*Set Pins Direction*/
+					SchM_Enter_Dio_PortAccess();
+					DIO_REG_WRITE(Ddr_Ptr, (uint8)((DIO_REG_READ(Ddr_Ptr) & (uint8)(~Mask)) | (Direction & Mask)));
+					SchM_Exit_Dio_PortAccess();
+				} else {
+					/* Do Nothing (there's no configured channel on this port) */
+				}
+			}
+
+#if (DIO_DEBOUNCE_API == STD_ON)
+			/* Start the debouncer from the current levels, with all the counters cleared */
+			Dio_LatchInputs(&Dio_Debounce.State);
+			for (uint8 Bit = 0; Bit < DIO_DEBOUNCE_COUNTER_BITS; ++Bit) {
+				for (uint8 PortIndex = 0; PortIndex < DIO_IMAGE_PORTS; ++PortIndex) {
+					Dio_Debounce.Count[Bit][PortIndex] = 0U;
 				}
 			}
+#endif
+#if (DIO_NOTIFICATION_API == STD_ON)
+			/* No edge is notified for the levels found at initialization */
+			Dio_LatchInputs(&Dio_NotifyPrevious);
+#endif
+#if (DIO_DEFERRED_WRITE == STD_ON)
+			/* The shadows start from the latches just written, nothing to commit */
+			for (uint8 PortIndex = 0; PortIndex < DIO_CONFIGURED_PORTS; ++PortIndex) {
+				Dio_OutputShadow[PortIndex] = DIO_REG_READ(Dio_PortMap[PortIndex].Port);
+				Dio_DirtyPorts[PortIndex] = FALSE;
+			}
+#endif
 		} else {
 			/* Do Nothing */
 		}
 	}
+	DIO_SERVICE_EXIT(DIO_INIT_SID, (NULL_PTR == ConfigPtr));
 }
 
 /* =============================================================================
@@ -182,7 +474,8 @@ void Dio_Init(const Dio_ConfigType *ConfigPtr) {
  * Description: Function to set the direction of a channel.
  * =============================================================================*/
 void Dio_SetupChannelDirection(Dio_PortType Port_Id, Dio_ChannelType Channel_Id, Dio_Direction dir) {
-	volatile uint8 *Port_Ptr = NULL_PTR;
+	DIO_SERVICE_ENTER(DIO_SETUP_CHANNEL_DIRECTION_SID);
+	volatile uint8 *Ddr_Ptr = NULL_PTR;
 	boolean error = FALSE;
 
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
@@ -193,8 +486,8 @@ void Dio_SetupChannelDirection(Dio_PortType Port_Id, Dio_ChannelType Channel_Id,
 	} else {
 		/* No Action Required */
 	}
-	/* Check if the used channel is within the valid range */
-	if (DIO_CONFIGURED_CHANNLES <= Channel_Id) {
+	/* Check if the used channel is within the valid range and bonded out */
+	if (FALSE == isChannelValid(Port_Id, Channel_Id)) {
 		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_SETUP_CHANNEL_DIRECTION_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
 		error = TRUE;
 	} else {
@@ -204,29 +497,21 @@ void Dio_SetupChannelDirection(Dio_PortType Port_Id, Dio_ChannelType Channel_Id,
 
 	/* In-case there are no errors */
 	if (FALSE == error) {
-		uint8 ChannelNum = getChannelNum(Channel_Id);
-
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Id member */
-		switch (Port_Id) {
-		case (PORTA_ID):
-			Port_Ptr = &DDRA;
-			break;
-		case (PORTB_ID):
-			Port_Ptr = &DDRB;
-			break;
-		case (PORTC_ID):
-			Port_Ptr = &DDRC;
-			break;
-		case (PORTD_ID):
-			Port_Ptr = &DDRD;
-			break;
-		}
+		uint8 Index = getChannelIndex(Port_Id, Channel_Id);
 
-		if (Port_Ptr != NULL_PTR) {
-			if (GET_BIT(*Port_Ptr, ChannelNum) == INPUT) {
-				SET_BIT(*Port_Ptr, ChannelNum);
-			} else if (GET_BIT(*Port_Ptr, ChannelNum) == OUTPUT) {
-				CLEAR_BIT(*Port_Ptr, ChannelNum);
+		if (Index < DIO_TOTAL_CHANNLES) {
+			uint8 Mask = Dio_ChannelMap[Index].Mask;
+			/* Point to the DDR register of the channel */
+			Ddr_Ptr = Dio_ChannelMap[Index].Ddr;
+
+			if (dir == OUTPUT) {
+				SchM_Enter_Dio_PortAccess();
+				DIO_REG_WRITE(Ddr_Ptr, (uint8)(DIO_REG_READ(Ddr_Ptr) | Mask));
+				SchM_Exit_Dio_PortAccess();
+			} else if (dir == INPUT) {
+				SchM_Enter_Dio_PortAccess();
+				DIO_REG_WRITE(Ddr_Ptr, (uint8)(DIO_REG_READ(Ddr_Ptr) & (uint8)(~Mask)));
+				SchM_Exit_Dio_PortAccess();
 			} else {
 				/* Do Nothing */
 			}
@@ -234,6 +519,7 @@ void Dio_SetupChannelDirection(Dio_PortType Port_Id, Dio_ChannelType Channel_Id,
 			/* Do Nothing */
 		}
 	}
+	DIO_SERVICE_EXIT(DIO_SETUP_CHANNEL_DIRECTION_SID, error);
 }
 
 /* =============================================================================
@@ -246,23 +532,24 @@ void Dio_SetupChannelDirection(Dio_PortType Port_Id, Dio_ChannelType Channel_Id,
  * Parameters (input): None
  * Parameters (out): None
  * Return value: None
- * Description: Function to set the direction of a port.
+ * Description: Function to set the direction of all the pins of a port
+ *              (INPUT -> DDRx = 0x00, OUTPUT -> DDRx = 0xFF).
  * =============================================================================*/
 void Dio_SetupPortDirection(Dio_PortType Port_Id, Dio_Direction dir) {
+	DIO_SERVICE_ENTER(DIO_SETUP_PORD_DIRECTION_SID);
 	volatile uint8 *Port_Ptr = NULL_PTR;
 	boolean error = FALSE;
 
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
 	/* Check if the Driver is initialized before using this function */
 	if (DIO_NOT_INITIALIZED == Dio_Status) {
-		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_CHANNEL_SID, DIO_E_UNINIT);
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_SETUP_PORD_DIRECTION_SID, DIO_E_UNINIT);
 		error = TRUE;
 	} else {
 		/* No Action Required */
 	}
-	/* Check if the used channel is within the valid range */
-	if (DIO_CONFIGURED_PORTS <= Port_Id) {
-
+	/* Check if the used port is within the valid range */
+	if ((uint8)(Port_Id - PORTA_ID) >= DIO_CONFIGURED_PORTS) {
 		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_SETUP_PORD_DIRECTION_SID, DIO_E_PARAM_INVALID_PORT_ID);
 		error = TRUE;
 	} else {
@@ -270,32 +557,30 @@ void Dio_SetupPortDirection(Dio_PortType Port_Id, Dio_Direction dir) {
 	}
 #endif
 
-	/* Point to the correct PORT register according to the Port Id stored in the Port_Id member */
-	switch (Port_Id) {
-	case (PORTA_ID):
-		Port_Ptr = &DDRA;
-		break;
-	case (PORTB_ID):
-		Port_Ptr = &DDRB;
-		break;
-	case (PORTC_ID):
-		Port_Ptr = &DDRC;
-		break;
-	case (PORTD_ID):
-		Port_Ptr = &DDRD;
-		break;
-	}
-	if (Port_Ptr != NULL_PTR) {
-		if (dir == INPUT) {
-			*Port_Ptr = dir;
-		} else if (dir == OUTPUT) {
-			*Port_Ptr = dir;
+	/* In-case there are no errors */
+	if (FALSE == error) {
+		uint8 PortIndex = (uint8)(Port_Id - PORTA_ID);
+
+		/* Point to the DDR register of the port, one table load whatever the number of ports */
+		if (PortIndex < DIO_CONFIGURED_PORTS) {
+			Port_Ptr = Dio_PortMap[PortIndex].Ddr;
+		} else {
+			/* Do Nothing */
+		}
+		if (Port_Ptr != NULL_PTR) {
+			/* All the pins of the port take the same direction */
+			if (dir == INPUT) {
+				DIO_REG_WRITE(Port_Ptr, 0x00U);
+			} else if (dir == OUTPUT) {
+				DIO_REG_WRITE(Port_Ptr, 0xFFU);
+			} else {
+				/* Do Nothing */
+			}
 		} else {
 			/* Do Nothing */
 		}
-	} else {
-		/* Do Nothing */
 	}
+	DIO_SERVICE_EXIT(DIO_SETUP_PORD_DIRECTION_SID, error);
 }
 
 /* =============================================================================
@@ -312,6 +597,7 @@ void Dio_SetupPortDirection(Dio_PortType Port_Id, Dio_Direction dir) {
  * Description: Function to set a level of a channel.
  * =============================================================================*/
 void Dio_WriteChannel(Dio_PortType Port_Id, Dio_ChannelType Channel_Id,Dio_PinLevelType level) {
+	DIO_SERVICE_ENTER(DIO_WRITE_CHANNEL_SID);
 	volatile uint8 *Port_Ptr = NULL_PTR;
 	boolean error = FALSE;
 
@@ -323,9 +609,8 @@ void Dio_WriteChannel(Dio_PortType Port_Id, Dio_ChannelType Channel_Id,Dio_PinLe
 	} else {
 		/* No Action Required */
 	}
-	/* Check if the used channel is within the valid range */
-	if (DIO_CONFIGURED_CHANNLES <= Channel_Id) {
-
+	/* Check if the used channel is within the valid range and bonded out */
+	if (FALSE == isChannelValid(Port_Id, Channel_Id)) {
 		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
 		error = TRUE;
 	} else {
@@ -335,27 +620,23 @@ void Dio_WriteChannel(Dio_PortType Port_Id, Dio_ChannelType Channel_Id,Dio_PinLe
 
 	/* In-case there are no errors */
 	if (FALSE == error) {
-		uint8 ChannelNum = getChannelNum(Channel_Id);
-
-		switch (Port_Id) {
-		case (PORTA_ID):
-			Port_Ptr = &PORTA;
-			break;
-		case (PORTB_ID):
-			Port_Ptr = &PORTB;
-			break;
-		case (PORTC_ID):
-			Port_Ptr = &PORTC;
-			break;
-		case (PORTD_ID):
-			Port_Ptr = &PORTD;
-			break;
-		}
-		if (Port_Ptr != NULL_PTR) {
+		uint8 Index = getChannelIndex(Port_Id, Channel_Id);
+
+		if (Index < DIO_TOTAL_CHANNLES) {
+			uint8 Mask = Dio_ChannelMap[Index].Mask;
+			/* Point to the PORT register of the channel */
+			Port_Ptr = Dio_ChannelMap[Index].Port;
+
 			if (level == STD_HIGH) {
-				SET_BIT(*Port_Ptr, ChannelNum);
+				SchM_Enter_Dio_PortAccess();
+				DIO_OUTPUT_WRITE(DIO_CHANNEL_PORT_INDEX(Index), Port_Ptr,
+						(uint8)(DIO_OUTPUT_READ(DIO_CHANNEL_PORT_INDEX(Index), Port_Ptr) | Mask));
+				SchM_Exit_Dio_PortAccess();
 			} else if (level == STD_LOW) {
-				CLEAR_BIT(*Port_Ptr, ChannelNum);
+				SchM_Enter_Dio_PortAccess();
+				DIO_OUTPUT_WRITE(DIO_CHANNEL_PORT_INDEX(Index), Port_Ptr,
+						(uint8)(DIO_OUTPUT_READ(DIO_CHANNEL_PORT_INDEX(Index), Port_Ptr) & (uint8)(~Mask)));
+				SchM_Exit_Dio_PortAccess();
 			} else {
 				/* Do Nothing */
 			}
@@ -363,6 +644,7 @@ void Dio_WriteChannel(Dio_PortType Port_Id, Dio_ChannelType Channel_Id,Dio_PinLe
 			/* Do Nothing */
 		}
 	}
+	DIO_SERVICE_EXIT(DIO_WRITE_CHANNEL_SID, error);
 }
 
 
@@ -381,7 +663,8 @@ void Dio_WriteChannel(Dio_PortType Port_Id, Dio_ChannelType Channel_Id,Dio_PinLe
  * Description: Function to Return the value of the specified DIO channel.
  * =============================================================================*/
 Dio_LevelType Dio_ReadChannel(Dio_PortType Port_Id, Dio_ChannelType Channel_Id) {
-	volatile uint8 *Port_Ptr = NULL_PTR;
+	DIO_SERVICE_ENTER(DIO_READ_CHANNEL_SID);
+	volatile uint8 *Pin_Ptr = NULL_PTR;
 	Dio_LevelType output = STD_LOW;
 	boolean error = FALSE;
 
@@ -393,9 +676,8 @@ Dio_LevelType Dio_ReadChannel(Dio_PortType Port_Id, Dio_ChannelType Channel_Id)
 	} else {
 		/* No Action Required */
 	}
-	/* Check if the used channel is within the valid range */
-	if (DIO_CONFIGURED_CHANNLES <= Channel_Id) {
-
+	/* Check if the used channel is within the valid range and bonded out */
+	if (FALSE == isChannelValid(Port_Id, Channel_Id)) {
 		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
 		error = TRUE;
 	} else {
@@ -405,35 +687,22 @@ Dio_LevelType Dio_ReadChannel(Dio_PortType Port_Id, Dio_ChannelType Channel_Id)
 
 	/* In-case there are no errors */
 	if (FALSE == error) {
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Id member */
-
-		uint8 pinNum = getChannelNum(Channel_Id);
-		switch (Port_Id) {
-			case (PORTA_ID):
-			Port_Ptr = &PORTA;
-			break;
-			case (PORTB_ID):
-			Port_Ptr = &PORTB;
-			break;
-			case (PORTC_ID):
-			Port_Ptr = &PORTC;
-			break;
-			case  (PORTD_ID):
-			Port_Ptr = &PORTD;
-			break;
-		}
-		if (Port_Ptr != NULL_PTR) {
-			if (GET_BIT(*Port_Ptr, pinNum) == STD_HIGH) {
+		uint8 Index = getChannelIndex(Port_Id, Channel_Id);
+
+		if (Index < DIO_TOTAL_CHANNLES) {
+			/* Point to the PIN register of the channel (physical level of the pin) */
+			Pin_Ptr = Dio_ChannelMap[Index].Pin;
+
+			if ((DIO_REG_READ(Pin_Ptr) & Dio_ChannelMap[Index].Mask) != 0U) {
 				output = STD_HIGH;
-			} else if (GET_BIT(*Port_Ptr, pinNum) == STD_LOW) {
-				output = STD_LOW;
 			} else {
-				/* Do Nothing */
+				output = STD_LOW;
 			}
 		} else {
 			/* Do Nothing */
 		}
 	}
+	DIO_SERVICE_EXIT(DIO_READ_CHANNEL_SID, error);
 	return output;
 }
 
@@ -442,27 +711,29 @@ Dio_LevelType Dio_ReadChannel(Dio_PortType Port_Id, Dio_ChannelType Channel_Id)
  * Service ID[hex]: 0x03
  * Sync/Async: Synchronous
  * Reentrancy: Reentrant
- * PortId ID of DIO Port Parameters (in): Level Value to be written
+ * Parameters (in): Port_Id - ID of DIO port.
+ *                  Level - Value to be written (bit n = pin n).
  * Parameters(inout):None
  * Parameters (out): None
  * Return value: None
- * Description: Service to set a value of the port
+ * Description: Service to set a value of the port. All the pins of the port take the
+ *              level of their bit of Level with a single store.
  * =============================================================================*/
-void Dio_WritePort(Dio_PortType Port_Id, Dio_PinLevelType level) {
+void Dio_WritePort(Dio_PortType Port_Id, Dio_PortLevelType Level) {
+	DIO_SERVICE_ENTER(DIO_WRITE_PORT_SID);
 	volatile uint8 *Port_Ptr = NULL_PTR;
 	boolean error = FALSE;
 
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
 	/* Check if the Driver is initialized before using this function */
 	if (DIO_NOT_INITIALIZED == Dio_Status) {
-		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_CHANNEL_SID,DIO_E_UNINIT);
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_PORT_SID, DIO_E_UNINIT);
 		error = TRUE;
 	} else {
 		/* No Action Required */
 	}
-	/* Check if the used channel is within the valid range */
-	if (DIO_CONFIGURED_PORTS <= Port_Id) {
-
+	/* Check if the used port is within the valid range */
+	if ((uint8)(Port_Id - PORTA_ID) >= DIO_CONFIGURED_PORTS) {
 		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_PORT_SID,
 				DIO_E_PARAM_INVALID_PORT_ID);
 		error = TRUE;
@@ -473,34 +744,89 @@ void Dio_WritePort(Dio_PortType Port_Id, Dio_PinLevelType level) {
 
 	/* In-case there are no errors */
 	if (FALSE == error) {
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Id member */
-		switch (Port_Id) {
-		case 1:
-			Port_Ptr = &PORTA;
-			break;
-		case 2:
-			Port_Ptr = &PORTB;
-			break;
-		case 3:
-			Port_Ptr = &PORTC;
-			break;
-		case 4:
-			Port_Ptr = &PORTD;
-			break;
+		uint8 PortIndex = (uint8)(Port_Id - PORTA_ID);
+
+		/* Point to the PORT register of the port, one table load whatever the number of ports */
+		if (PortIndex < DIO_CONFIGURED_PORTS) {
+			Port_Ptr = Dio_PortMap[PortIndex].Port;
+		} else {
+			/* Do Nothing */
 		}
 		if (Port_Ptr != NULL_PTR) {
-			if (level == STD_HIGH) {
-				*Port_Ptr |= level;
-			} else if (level == STD_LOW) {
-				*Port_Ptr |= level;
-			} else {
-				/* Do Nothing */
-			}
+#if (DIO_DEFERRED_WRITE == STD_ON)
+			/* The shadow store and its dirty flag are kept together against a
+			 * concurrent Dio_CommitOutputs */
+			SchM_Enter_Dio_PortAccess();
+			DIO_OUTPUT_WRITE(PortIndex, Port_Ptr, Level);
+			SchM_Exit_Dio_PortAccess();
+#else
+			/* Whole byte store, nothing of the previous latch is kept so no lock is needed */
+			DIO_OUTPUT_WRITE(PortIndex, Port_Ptr, Level);
+#endif
+		} else {
+			/* Do Nothing */
+		}
+	}
+	DIO_SERVICE_EXIT(DIO_WRITE_PORT_SID, error);
+}
+
+#if (DIO_MASKED_WRITE_PORT_API == STD_ON)
+/* =============================================================================
+ * Service Name: Dio_MaskedWritePort
+ * Service ID[hex]: 0x13
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Port_Id - ID of DIO port.
+ *                  Level - Value to be written (bit n = pin n).
+ *                  Mask - Pins to be written (bit n = pin n).
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Service to set the value of the pins of a port selected by Mask, the other
+ *              pins keep their level. The masked pins change with the same store, inside
+ *              the Dio_PortAccess exclusive area (DIO_ATOMIC_ACCESS).
+ * =============================================================================*/
+void Dio_MaskedWritePort(Dio_PortType Port_Id, Dio_PortLevelType Level, Dio_PortLevelType Mask) {
+	DIO_SERVICE_ENTER(DIO_MASKED_WRITE_PORT_SID);
+	volatile uint8 *Port_Ptr = NULL_PTR;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status) {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_MASKED_WRITE_PORT_SID, DIO_E_UNINIT);
+		error = TRUE;
+	} else {
+		/* No Action Required */
+	}
+	/* Check if the used port is within the valid range */
+	if ((uint8)(Port_Id - PORTA_ID) >= DIO_CONFIGURED_PORTS) {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_MASKED_WRITE_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+		error = TRUE;
+	} else {
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if (FALSE == error) {
+		uint8 PortIndex = (uint8)(Port_Id - PORTA_ID);
+
+		if (PortIndex < DIO_CONFIGURED_PORTS) {
+			uint8 Value = (uint8)(Level & Mask);
+			Port_Ptr = Dio_PortMap[PortIndex].Port;
+
+			/* Single read-modify-write: the pins outside of Mask keep their level */
+			SchM_Enter_Dio_PortAccess();
+			DIO_OUTPUT_WRITE(PortIndex, Port_Ptr, (uint8)((DIO_OUTPUT_READ(PortIndex, Port_Ptr) & (uint8)(~Mask)) | Value));
+			SchM_Exit_Dio_PortAccess();
 		} else {
 			/* Do Nothing */
 		}
 	}
+	DIO_SERVICE_EXIT(DIO_MASKED_WRITE_PORT_SID, error);
 }
+#endif
 
 /* =============================================================================
  * Service Name: Dio_ReadPort
@@ -514,21 +840,21 @@ void Dio_WritePort(Dio_PortType Port_Id, Dio_PinLevelType level) {
  * Description: Function to Returns the level of all channels of that port.
  * =============================================================================*/
 Dio_PortLevelType Dio_ReadPort(Dio_PortType Port_Id) {
-	Dio_LevelType output = STD_LOW;
+	DIO_SERVICE_ENTER(DIO_READ_PORT_SID);
+	Dio_PortLevelType output = STD_LOW;
 	boolean error = FALSE;
 
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
 	/* Check if the Driver is initialized before using this function */
 	if (DIO_NOT_INITIALIZED == Dio_Status) {
-		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_CHANNEL_SID,
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_PORT_SID,
 				DIO_E_UNINIT);
 		error = TRUE;
 	} else {
 		/* No Action Required */
 	}
-	/* Check if the used channel is within the valid range */
-	if (DIO_CONFIGURED_CHANNLES <= Port_Id) {
-
+	/* Check if the used port is within the valid range */
+	if ((uint8)(Port_Id - PORTA_ID) >= DIO_CONFIGURED_PORTS) {
 		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_PORT_SID,
 				DIO_E_PARAM_INVALID_PORT_ID);
 		error = TRUE;
@@ -539,54 +865,97 @@ Dio_PortLevelType Dio_ReadPort(Dio_PortType Port_Id) {
 
 	/* In-case there are no errors */
 	if (FALSE == error) {
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Id member */
-		switch (Port_Id) {
-		case (PORTA_ID):
-			output = PINA;
-			break;
-		case (PORTB_ID):
-			output = PINB;
-			break;
-		case (PORTC_ID):
-			output = PINC;
-			break;
-		case (PORTD_ID):
-			output = PIND;
-			break;
+		uint8 PortIndex = (uint8)(Port_Id - PORTA_ID);
+
+		/* Read the PIN register of the port, one table load whatever the number of ports */
+		if (PortIndex < DIO_CONFIGURED_PORTS) {
+			output = DIO_REG_READ(Dio_PortMap[PortIndex].Pin);
+		} else {
+			/* Do Nothing */
 		}
 	}
+	DIO_SERVICE_EXIT(DIO_READ_PORT_SID, error);
 	return output;
 }
 
 /* =============================================================================
- * Service Name:  Dio_FlipChannel
- * Service ID[hex]: 0x11
+ * Service Name: Dio_ReadChannelGroup
+ * Service ID[hex]: 0x04
  * Sync/Async: Synchronous
  * Reentrancy: Reentrant
- * Parameters (in): Port_Id - ID of DIO port.
- * 				    Channel_Id - ID of DIO pin.
+ * Parameters (in): ChannelGroupIdPtr - Pointer to ChannelGroup.
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: Dio_PortLevelType Level of a subset of the adjoining bits of a port
+ * Description: This Service reads a subset of the adjoining bits of a port.
+ * =============================================================================*/
+Dio_PortLevelType Dio_ReadChannelGroup(DIO_CONFIG_CONST Dio_ChannelGroupType *ChannelGroupIdPtr) {
+	DIO_SERVICE_ENTER(DIO_READ_CHANNEL_GROUP_SID);
+	Dio_PortLevelType output = STD_LOW;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status) {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_CHANNEL_GROUP_SID, DIO_E_UNINIT);
+		error = TRUE;
+	} else {
+		/* No Action Required */
+	}
+	/* Check if the used channel group is valid */
+	if ((NULL_PTR == ChannelGroupIdPtr) || ((uint8)(ChannelGroupIdPtr->port - PORTA_ID) >= DIO_CONFIGURED_PORTS)) {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_CHANNEL_GROUP_SID, DIO_E_PARAM_INVALID_GROUP);
+		error = TRUE;
+	} else {
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if (FALSE == error) {
+		uint8 PortIndex = (uint8)(ChannelGroupIdPtr->port - PORTA_ID);
+
+		if (PortIndex < DIO_CONFIGURED_PORTS) {
+			/* One read of the PIN register for the whole group */
+			output = (Dio_PortLevelType)((DIO_REG_READ(Dio_PortMap[PortIndex].Pin) & ChannelGroupIdPtr->mask) >> ChannelGroupIdPtr->offset);
+		} else {
+			/* Do Nothing */
+		}
+	}
+	DIO_SERVICE_EXIT(DIO_READ_CHANNEL_GROUP_SID, error);
+	return output;
+}
+
+/* =============================================================================
+ * Service Name: Dio_WriteChannelGroup
+ * Service ID[hex]: 0x05
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): ChannelGroupIdPtr - Pointer to ChannelGroup.
+ *                  Level - Value to be written.
  * Parameters (input): None
  * Parameters (out): None
  * Return value: None
- * Description: Service to flip (change from 1 to 0 or from 0 to 1) the level of a channel and return
- *              the level of the channel after flip.
+ * Description: Service to set a subset of the adjoining bits of a port to a specified level.
+ *              All channels of the group change with the same store, so no intermediate
+ *              state of the group is visible on the pins.
  * =============================================================================*/
-void  Dio_FlipChannel(Dio_PortType Port_Id, Dio_ChannelType Channel_Id) {
+void Dio_WriteChannelGroup(DIO_CONFIG_CONST Dio_ChannelGroupType *ChannelGroupIdPtr, Dio_PortLevelType Level) {
+	DIO_SERVICE_ENTER(DIO_WRITE_CHANNEL_GROUP_SID);
 	volatile uint8 *Port_Ptr = NULL_PTR;
 	boolean error = FALSE;
 
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
 	/* Check if the Driver is initialized before using this function */
 	if (DIO_NOT_INITIALIZED == Dio_Status) {
-		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_CHANNEL_SID, DIO_E_UNINIT);
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_CHANNEL_GROUP_SID, DIO_E_UNINIT);
 		error = TRUE;
 	} else {
 		/* No Action Required */
 	}
-	/* Check if the used channel is within the valid range */
-	if (DIO_CONFIGURED_CHANNLES <= Channel_Id) {
-
-		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_TOGGLE_PIN_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+	/* Check if the used channel group is valid */
+	if ((NULL_PTR == ChannelGroupIdPtr) || ((uint8)(ChannelGroupIdPtr->port - PORTA_ID) >= DIO_CONFIGURED_PORTS)) {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_CHANNEL_GROUP_SID, DIO_E_PARAM_INVALID_GROUP);
 		error = TRUE;
 	} else {
 		/* No Action Required */
@@ -595,37 +964,542 @@ void  Dio_FlipChannel(Dio_PortType Port_Id, Dio_ChannelType Channel_Id) {
 
 	/* In-case there are no errors */
 	if (FALSE == error) {
-		uint8 ChannelNum = getChannelNum(Channel_Id);
-
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Id member */
-		switch (Port_Id) {
-		case (PORTA_ID):
-			Port_Ptr = &PORTA;
-			break;
-		case (PORTB_ID):
-			Port_Ptr = &PORTB;
-			break;
-		case (PORTC_ID):
-			Port_Ptr = &PORTC;
-			break;
-		case PORTD_ID:
-			Port_Ptr = &PORTD;
-			break;
-		}
-		if (Port_Ptr != NULL_PTR) {
-			if (GET_BIT(*Port_Ptr, ChannelNum) == STD_HIGH) {
-				CLEAR_BIT(*Port_Ptr, ChannelNum);
-			} else if (GET_BIT(*Port_Ptr, ChannelNum) == STD_LOW) {
-				SET_BIT(*Port_Ptr, ChannelNum);
-			} else {
-				/* Do Nothing */
-			}
+		uint8 PortIndex = (uint8)(ChannelGroupIdPtr->port - PORTA_ID);
+
+		if (PortIndex < DIO_CONFIGURED_PORTS) {
+			uint8 Mask = ChannelGroupIdPtr->mask;
+			uint8 Value = (uint8)((uint8)(Level << ChannelGroupIdPtr->offset) & Mask);
+			Port_Ptr = Dio_PortMap[PortIndex].Port;
+
+			/* Single read-modify-write: the other channels of the port keep their level */
+			SchM_Enter_Dio_PortAccess();
+			DIO_OUTPUT_WRITE(PortIndex, Port_Ptr, (uint8)((DIO_OUTPUT_READ(PortIndex, Port_Ptr) & (uint8)(~Mask)) | Value));
+			SchM_Exit_Dio_PortAccess();
 		} else {
 			/* Do Nothing */
 		}
 	}
+	DIO_SERVICE_EXIT(DIO_WRITE_CHANNEL_GROUP_SID, error);
 }
 
+/* =============================================================================
+ * Service Name: Dio_WriteChannels32
+ * Service ID[hex]: 0x09
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Mask - Channels to be written (bit n = channel n).
+ *                  Level - Levels to be written (bit n = channel n).
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Service to set the level of any set of channels of PORTA .. PORTD.
+ *              Ports whose mask byte is zero are not accessed at all.
+ * =============================================================================*/
+void Dio_WriteChannels32(Dio_ChannelsLevelType Mask, Dio_ChannelsLevelType Level) {
+	DIO_SERVICE_ENTER(DIO_WRITE_CHANNELS32_SID);
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status) {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_CHANNELS32_SID, DIO_E_UNINIT);
+		error = TRUE;
+	} else {
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if (FALSE == error) {
+		for (uint8 PortIndex = 0; PortIndex < DIO_IMAGE_PORTS; ++PortIndex) {
+			uint8 PortMask = (uint8)Mask;
+
+			if (PortMask != 0U) {
+				volatile uint8 *Port_Ptr = Dio_PortMap[PortIndex].Port;
+				uint8 Value = (uint8)((uint8)Level & PortMask);
+
+				/* One lock per port, the interrupts are never disabled across several ports */
+				SchM_Enter_Dio_PortAccess();
+				DIO_OUTPUT_WRITE(PortIndex, Port_Ptr, (uint8)((DIO_OUTPUT_READ(PortIndex, Port_Ptr) & (uint8)(~PortMask)) | Value));
+				SchM_Exit_Dio_PortAccess();
+			} else {
+				/* Do Nothing */
+			}
+			/* Move the next port to the low byte (byte moves only, no bit shifting loop) */
+			Mask >>= NUM_OF_PINS_IN_SINGLE_PORT;
+			Level >>= NUM_OF_PINS_IN_SINGLE_PORT;
+		}
+	}
+	DIO_SERVICE_EXIT(DIO_WRITE_CHANNELS32_SID, error);
+}
+
+/* =============================================================================
+ * Service Name: Dio_ReadChannels32
+ * Service ID[hex]: 0x0A
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): None
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: Dio_ChannelsLevelType Level of all the channels of PORTA .. PORTD (bit n = channel n)
+ * Description: Function to return the physical level of all the channels of PORTA .. PORTD.
+ * =============================================================================*/
+Dio_ChannelsLevelType Dio_ReadChannels32(void) {
+	DIO_SERVICE_ENTER(DIO_READ_CHANNELS32_SID);
+	Dio_ChannelsLevelType output = 0U;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status) {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_CHANNELS32_SID, DIO_E_UNINIT);
+		error = TRUE;
+	} else {
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if (FALSE == error) {
+		/* Start from the last port so every port is shifted in by whole bytes */
+		for (uint8 PortIndex = DIO_IMAGE_PORTS; PortIndex > 0U; --PortIndex) {
+			output = (output << NUM_OF_PINS_IN_SINGLE_PORT) | DIO_REG_READ(Dio_PortMap[PortIndex - 1U].Pin);
+		}
+	}
+	DIO_SERVICE_EXIT(DIO_READ_CHANNELS32_SID, error);
+	return output;
+}
+
+/* =============================================================================
+ * Service Name: Dio_SampleInputs
+ * Service ID[hex]: 0x0C
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): None
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: Dio_ChannelsLevelType The new snapshot (bit n = channel n)
+ * Description: Function to latch PINA .. PIND back to back into the input snapshot.
+ *              The four registers are read first (four consecutive "in" instructions)
+ *              and then stored byte by byte, without any shifting.
+ * =============================================================================*/
+Dio_ChannelsLevelType Dio_SampleInputs(void) {
+	DIO_SERVICE_ENTER(DIO_SAMPLE_INPUTS_SID);
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status) {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_SAMPLE_INPUTS_SID, DIO_E_UNINIT);
+		error = TRUE;
+	} else {
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if (FALSE == error) {
+		Dio_LatchInputs(&Dio_InputSnapshot);
+	}
+	DIO_SERVICE_EXIT(DIO_SAMPLE_INPUTS_SID, error);
+	return Dio_InputSnapshot.Channels;
+}
+
+/* =============================================================================
+ * Service Name: Dio_ReadSampledChannel
+ * Service ID[hex]: 0x0D
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Channel_Id - ID of DIO channel (PIN_A_0 .. PIN_D_7).
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: Dio_LevelType
+ * 				 STD_HIGH The level of the channel in the last snapshot is STD_HIGH
+ * 				 STD_LOW The level of the channel in the last snapshot is STD_LOW
+ * Description: Function to return the level of a channel from the last snapshot.
+ * =============================================================================*/
+Dio_LevelType Dio_ReadSampledChannel(Dio_ChannelType Channel_Id) {
+	DIO_SERVICE_ENTER(DIO_READ_SAMPLED_CHANNEL_SID);
+	Dio_LevelType output = STD_LOW;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status) {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_SAMPLED_CHANNEL_SID, DIO_E_UNINIT);
+		error = TRUE;
+	} else {
+		/* No Action Required */
+	}
+#endif
+	/* Check if the used channel is within the valid range (also protects the snapshot index) */
+	if (DIO_IMAGE_CHANNELS <= Channel_Id) {
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_SAMPLED_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+#endif
+		error = TRUE;
+	} else {
+		/* No Action Required */
+	}
+
+	/* In-case there are no errors */
+	if (FALSE == error) {
+		/* O(1): byte of the port, then the bit of the channel from the channel table */
+		if ((Dio_InputSnapshot.Ports[Channel_Id / NUM_OF_PINS_IN_SINGLE_PORT] & Dio_ChannelMap[Channel_Id].Mask) != 0U) {
+			output = STD_HIGH;
+		} else {
+			output = STD_LOW;
+		}
+	}
+	DIO_SERVICE_EXIT(DIO_READ_SAMPLED_CHANNEL_SID, error);
+	return output;
+}
+
+#if ((DIO_DEBOUNCE_API == STD_ON) || (DIO_NOTIFICATION_API == STD_ON))
+/* =============================================================================
+ * Service Name: Dio_MainFunction
+ * Service ID[hex]: 0x0E
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): None
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Cyclic function sampling all the channels at once, debouncing them
+ *              (DIO_DEBOUNCE_API) and calling the edge notifications of the channels that
+ *              changed (DIO_NOTIFICATION_API), on the debounced image when both are enabled.
+ * =============================================================================*/
+void Dio_MainFunction(void) {
+	DIO_SERVICE_ENTER(DIO_MAIN_FUNCTION_SID);
+	if (DIO_INITIALIZED == Dio_Status) {
+		Dio_InputSnapshotType Sample;
+
+		Dio_LatchInputs(&Sample);
+#if (DIO_DEBOUNCE_API == STD_ON)
+		Dio_DebounceInputs(&Sample);
+#if (DIO_NOTIFICATION_API == STD_ON)
+		Dio_NotifyChanges(&Dio_Debounce.State);
+#endif
+#else
+		Dio_NotifyChanges(&Sample);
+#endif
+	} else {
+		/* Do Nothing */
+	}
+	DIO_SERVICE_EXIT(DIO_MAIN_FUNCTION_SID, FALSE);
+}
+#endif
+
+#if (DIO_DEBOUNCE_API == STD_ON)
+/* =============================================================================
+ * Service Name: Dio_ReadDebouncedChannel
+ * Service ID[hex]: 0x0F
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Channel_Id - ID of DIO channel (PIN_A_0 .. PIN_D_7).
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: Dio_LevelType
+ * 				 STD_HIGH The debounced level of the channel is STD_HIGH
+ * 				 STD_LOW The debounced level of the channel is STD_LOW
+ * Description: Function to return the debounced level of a channel.
+ * =============================================================================*/
+Dio_LevelType Dio_ReadDebouncedChannel(Dio_ChannelType Channel_Id) {
+	DIO_SERVICE_ENTER(DIO_READ_DEBOUNCED_CHANNEL_SID);
+	Dio_LevelType output = STD_LOW;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status) {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_DEBOUNCED_CHANNEL_SID, DIO_E_UNINIT);
+		error = TRUE;
+	} else {
+		/* No Action Required */
+	}
+#endif
+	/* Check if the used channel is within the valid range (also protects the state index) */
+	if (DIO_IMAGE_CHANNELS <= Channel_Id) {
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_DEBOUNCED_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+#endif
+		error = TRUE;
+	} else {
+		/* No Action Required */
+	}
+
+	/* In-case there are no errors */
+	if (FALSE == error) {
+		if ((Dio_Debounce.State.Ports[Channel_Id / NUM_OF_PINS_IN_SINGLE_PORT] & Dio_ChannelMap[Channel_Id].Mask) != 0U) {
+			output = STD_HIGH;
+		} else {
+			output = STD_LOW;
+		}
+	}
+	DIO_SERVICE_EXIT(DIO_READ_DEBOUNCED_CHANNEL_SID, error);
+	return output;
+}
+
+/* =============================================================================
+ * Service Name: Dio_ReadDebouncedChannels32
+ * Service ID[hex]: 0x14
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): None
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: Dio_ChannelsLevelType Debounced level of all the channels (bit n = channel n)
+ * Description: Function to return the debounced level of all the channels of PORTA .. PORTD.
+ * =============================================================================*/
+Dio_ChannelsLevelType Dio_ReadDebouncedChannels32(void) {
+	DIO_SERVICE_ENTER(DIO_READ_DEBOUNCED_CHANNELS32_SID);
+	Dio_ChannelsLevelType output = 0U;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status) {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_DEBOUNCED_CHANNELS32_SID, DIO_E_UNINIT);
+	} else
+#endif
+	{
+		output = Dio_Debounce.State.Channels;
+	}
+	DIO_SERVICE_EXIT(DIO_READ_DEBOUNCED_CHANNELS32_SID, (DIO_NOT_INITIALIZED == Dio_Status));
+	return output;
+}
+#endif /* DIO_DEBOUNCE_API == STD_ON */
+
+/* =============================================================================
+ * Service Name: Dio_FlipChannels32
+ * Service ID[hex]: 0x0B
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Mask - Channels to be flipped (bit n = channel n).
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Service to flip the level of any set of channels of PORTA .. PORTD.
+ *              Ports whose mask byte is zero are not accessed at all.
+ * =============================================================================*/
+void Dio_FlipChannels32(Dio_ChannelsLevelType Mask) {
+	DIO_SERVICE_ENTER(DIO_FLIP_CHANNELS32_SID);
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status) {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_FLIP_CHANNELS32_SID, DIO_E_UNINIT);
+		error = TRUE;
+	} else {
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if (FALSE == error) {
+		for (uint8 PortIndex = 0; PortIndex < DIO_IMAGE_PORTS; ++PortIndex) {
+			uint8 PortMask = (uint8)Mask;
+
+			if (PortMask != 0U) {
+				volatile uint8 *Port_Ptr = Dio_PortMap[PortIndex].Port;
+
+				SchM_Enter_Dio_PortAccess();
+				DIO_OUTPUT_WRITE(PortIndex, Port_Ptr, (uint8)(DIO_OUTPUT_READ(PortIndex, Port_Ptr) ^ PortMask));
+				SchM_Exit_Dio_PortAccess();
+			} else {
+				/* Do Nothing */
+			}
+			Mask >>= NUM_OF_PINS_IN_SINGLE_PORT;
+		}
+	}
+	DIO_SERVICE_EXIT(DIO_FLIP_CHANNELS32_SID, error);
+}
+
+/* =============================================================================
+ * Service Name:  Dio_FlipChannel
+ * Service ID[hex]: 0x11
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Port_Id - ID of DIO port.
+ * 				    Channel_Id - ID of DIO pin.
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: Dio_LevelType
+ * 				 STD_HIGH The physical level of the corresponding Pin is STD_HIGH
+ * 				 STD_LOW The physical level of the corresponding Pin is STD_LOW
+ * Description: Service to flip (change from 1 to 0 or from 0 to 1) the level of a channel and return
+ *              the level of the channel after flip.
+ * =============================================================================*/
+Dio_LevelType Dio_FlipChannel(Dio_PortType Port_Id, Dio_ChannelType Channel_Id) {
+	DIO_SERVICE_ENTER(DIO_FLIP_CHANNEL_SID);
+	volatile uint8 *Port_Ptr = NULL_PTR;
+	Dio_LevelType output = STD_LOW;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status) {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_FLIP_CHANNEL_SID, DIO_E_UNINIT);
+		error = TRUE;
+	} else {
+		/* No Action Required */
+	}
+	/* Check if the used channel is within the valid range and bonded out */
+	if (FALSE == isChannelValid(Port_Id, Channel_Id)) {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_FLIP_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+		error = TRUE;
+	} else {
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if (FALSE == error) {
+		uint8 Index = getChannelIndex(Port_Id, Channel_Id);
+
+		if (Index < DIO_TOTAL_CHANNLES) {
+			uint8 Mask = Dio_ChannelMap[Index].Mask;
+			/* Point to the PORT register of the channel */
+			Port_Ptr = Dio_ChannelMap[Index].Port;
+
+			uint8 Latch;
+
+			/* Single XOR read-modify-write, the new latch value is kept for the return value */
+			SchM_Enter_Dio_PortAccess();
+			Latch = (uint8)(DIO_OUTPUT_READ(DIO_CHANNEL_PORT_INDEX(Index), Port_Ptr) ^ Mask);
+			DIO_OUTPUT_WRITE(DIO_CHANNEL_PORT_INDEX(Index), Port_Ptr, Latch);
+			SchM_Exit_Dio_PortAccess();
+
+			if ((Latch & Mask) != 0U) {
+				output = STD_HIGH;
+			} else {
+				output = STD_LOW;
+			}
+		} else {
+			/* Do Nothing */
+		}
+	}
+	DIO_SERVICE_EXIT(DIO_FLIP_CHANNEL_SID, error);
+	return output;
+}
+
+#if (DIO_DEFERRED_WRITE == STD_ON)
+/* =============================================================================
+ * Service Name: Dio_CommitOutputs
+ * Service ID[hex]: 0x15
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): None
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to push the output shadows written since the last commit to
+ *              the PORT registers: one store per dirty port, untouched ports are not accessed.
+ * =============================================================================*/
+void Dio_CommitOutputs(void) {
+	DIO_SERVICE_ENTER(DIO_COMMIT_OUTPUTS_SID);
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status) {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_COMMIT_OUTPUTS_SID, DIO_E_UNINIT);
+		error = TRUE;
+	} else {
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if (FALSE == error) {
+		for (uint8 PortIndex = 0; PortIndex < DIO_CONFIGURED_PORTS; ++PortIndex) {
+			boolean Dirty;
+			uint8 Latch;
+
+			/* Take the flag and the shadow together, an ISR writing an output of the port from
+			 * now on marks it again for the next commit */
+			SchM_Enter_Dio_PortAccess();
+			Dirty = Dio_DirtyPorts[PortIndex];
+			Dio_DirtyPorts[PortIndex] = FALSE;
+			Latch = Dio_OutputShadow[PortIndex];
+			SchM_Exit_Dio_PortAccess();
+
+			if (Dirty != FALSE) {
+				DIO_REG_WRITE(Dio_PortMap[PortIndex].Port, Latch);
+			} else {
+				/* Do Nothing */
+			}
+		}
+	}
+	DIO_SERVICE_EXIT(DIO_COMMIT_OUTPUTS_SID, error);
+}
+#endif
+
+#if (DIO_PROFILING == STD_ON)
+/* =============================================================================
+ * Service Name: Dio_GetStatistics
+ * Service ID[hex]: 0x1F
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): ServiceId - DIO_*_SID of a service of Dio.c.
+ * Parameters (input): None
+ * Parameters (out): Statistics - Copy of the statistics of the service.
+ * Return value: Std_ReturnType E_OK / E_NOT_OK
+ * Description: Function to read the call count, the error count and the duration
+ *              histogram of a service.
+ * =============================================================================*/
+Std_ReturnType Dio_GetStatistics(uint8 ServiceId, Dio_ServiceStatisticsType *Statistics) {
+	Std_ReturnType output = E_NOT_OK;
+
+	/* Check if input pointer is not Null pointer */
+	if (NULL_PTR == Statistics) {
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_GET_STATISTICS_SID, DIO_E_PARAM_POINTER);
+#endif
+	}
+	/* Check if the service has statistics */
+	else if (DIO_PROFILING_SERVICES <= ServiceId) {
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_GET_STATISTICS_SID, DIO_E_PARAM_CONFIG);
+#endif
+	} else {
+		/* Consistent copy, an ISR may update the statistics */
+		SchM_Enter_Dio_PortAccess();
+		*Statistics = Dio_Statistics[ServiceId];
+		SchM_Exit_Dio_PortAccess();
+		output = E_OK;
+	}
+	return output;
+}
+
+/* =============================================================================
+ * Service Name: Dio_ResetStatistics
+ * Service ID[hex]: 0x20
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): None
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to clear the statistics of all the services.
+ * =============================================================================*/
+void Dio_ResetStatistics(void) {
+	for (uint8 ServiceId = 0; ServiceId < DIO_PROFILING_SERVICES; ++ServiceId) {
+		Dio_ServiceStatisticsType *Statistics = &Dio_Statistics[ServiceId];
+
+		/* One service at a time, the lock stays short */
+		SchM_Enter_Dio_PortAccess();
+		Statistics->Calls = 0U;
+		Statistics->Errors = 0U;
+		Statistics->MaxTicks = 0U;
+		for (uint8 Bin = 0; Bin < DIO_PROFILING_BINS; ++Bin) {
+			Statistics->Histogram[Bin] = 0U;
+		}
+		SchM_Exit_Dio_PortAccess();
+	}
+}
+#endif
+
 /* =============================================================================
  * Service Name: Dio_GetVersionInfo
  * Service ID[hex]: 0x12
@@ -640,6 +1514,7 @@ void  Dio_FlipChannel(Dio_PortType Port_Id, Dio_ChannelType Channel_Id) {
 
 #if (DIO_VERSION_INFO_API == STD_ON)
 void Dio_GetVersionInfo(Std_VersionInfoType *versioninfo) {
+	DIO_SERVICE_ENTER(DIO_GET_VERSION_INFO_SID);
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
 	/* Check if input pointer is not Null pointer */
 	if (NULL_PTR == versioninfo) {
@@ -659,5 +1534,6 @@ void Dio_GetVersionInfo(Std_VersionInfoType *versioninfo) {
 		/* Copy Software Patch Version */
 		versioninfo->sw_patch_version = (uint8) DIO_SW_PATCH_VERSION;
 	}
+	DIO_SERVICE_EXIT(DIO_GET_VERSION_INFO_SID, (NULL_PTR == versioninfo));
 }
 #endif
@@ -21,6 +21,11 @@
 /* Non AUTOSAR files */
 #include "../LIB/Common_Macros.h"
 
+/* The C APIs are also used by the C++ template layer (Dio.hpp) */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /* =============================================================================
  * 								VERSION DEFINITION
  * =============================================================================*/
@@ -81,6 +86,47 @@
   #error "The SW version of Dio_Cfg.h does not match the expected version"
 #endif
 
+#if (DIO_DEBOUNCE_API == STD_ON)
+/* Range check of the debounce configuration */
+#if ((DIO_DEBOUNCE_SAMPLES < 1U) || (DIO_DEBOUNCE_SAMPLES > 8U))
+  #error "DIO_DEBOUNCE_SAMPLES shall be within 1 .. 8"
+#endif
+
+/* Number of bit planes of the vertical debounce counters (counter range 0 .. DIO_DEBOUNCE_SAMPLES - 1) */
+#if (DIO_DEBOUNCE_SAMPLES <= 2U)
+#define DIO_DEBOUNCE_COUNTER_BITS      (1U)
+#elif (DIO_DEBOUNCE_SAMPLES <= 4U)
+#define DIO_DEBOUNCE_COUNTER_BITS      (2U)
+#else
+#define DIO_DEBOUNCE_COUNTER_BITS      (3U)
+#endif
+#endif
+
+#if (DIO_PROFILING == STD_ON)
+/* Range check of the profiling configuration */
+#if ((DIO_PROFILING_BINS < 1U) || (DIO_PROFILING_BINS > 11U))
+  #error "DIO_PROFILING_BINS shall be within 1 .. 11"
+#endif
+
+/* Upper bound of the first histogram bin, in clock ticks (CPU cycles on the target) */
+#define DIO_PROFILING_BIN0_TICKS       (32U)
+
+/* Services with statistics: the SIDs 0x00 .. 0x15 of Dio.c */
+#define DIO_PROFILING_SERVICES         (0x16U)
+#endif
+
+/* The PWM and the pattern players write the PORT registers from a timer ISR; the next
+ * Dio_CommitOutputs would overwrite those pins with the stale shadow of their port */
+#if ((DIO_DEFERRED_WRITE == STD_ON) && ((DIO_PWM_API == STD_ON) || (DIO_PATTERN_API == STD_ON)))
+  #error "DIO_DEFERRED_WRITE cannot be combined with DIO_PWM_API or DIO_PATTERN_API"
+#endif
+
+/* Ports covered by the 32-bit channel images (input snapshot, debouncing, notifications,
+ * Dio_*Channels32, software PWM): PORTA .. PORTD on every device (DIO_DEVICE), the other
+ * ports are reached through the port and channel APIs */
+#define DIO_IMAGE_PORTS                (4U)
+#define DIO_IMAGE_CHANNELS             (DIO_IMAGE_PORTS * NUM_OF_PINS_IN_SINGLE_PORT)
+
 /* =============================================================================
  * 								DET ERROR CODES  
  * =============================================================================*/
@@ -124,14 +170,71 @@
 /* Service ID for DIO write Port */
 #define DIO_WRITE_PORT_SID             (uint8)0x03
 
+/* Service ID for DIO masked write Port */
+#define DIO_MASKED_WRITE_PORT_SID      (uint8)0x13
+
 /* Service ID for DIO read Channel Group */
-#define DIO_SETUP_CHANNEL_DIRECTION_SID    (uint8)0x04
+#define DIO_READ_CHANNEL_GROUP_SID     (uint8)0x04
 
 /* Service ID for DIO write Channel Group */
-#define DIO_SETUP_PORD_DIRECTION_SID   (uint8)0x05
+#define DIO_WRITE_CHANNEL_GROUP_SID    (uint8)0x05
 
-/* Service ID for DIO write Channel Group */
-#define DIO_TOGGLE_PIN_SID  		   (uint8)0x06
+/* Service ID for DIO setup Channel Direction (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_SETUP_CHANNEL_DIRECTION_SID    (uint8)0x07
+
+/* Service ID for DIO setup Port Direction (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_SETUP_PORD_DIRECTION_SID   (uint8)0x08
+
+/* Service ID for DIO flip Channel */
+#define DIO_FLIP_CHANNEL_SID           (uint8)0x11
+
+/* Service ID for DIO write Channels32 (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_WRITE_CHANNELS32_SID       (uint8)0x09
+
+/* Service ID for DIO read Channels32 (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_READ_CHANNELS32_SID        (uint8)0x0A
+
+/* Service ID for DIO flip Channels32 (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_FLIP_CHANNELS32_SID        (uint8)0x0B
+
+/* Service ID for DIO sample Inputs (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_SAMPLE_INPUTS_SID          (uint8)0x0C
+
+/* Service ID for DIO read Sampled Channel (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_READ_SAMPLED_CHANNEL_SID   (uint8)0x0D
+
+/* Service ID for DIO Main Function (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_MAIN_FUNCTION_SID          (uint8)0x0E
+
+/* Service ID for DIO read Debounced Channel (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_READ_DEBOUNCED_CHANNEL_SID (uint8)0x0F
+
+/* Service ID for DIO read Debounced Channels32 (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_READ_DEBOUNCED_CHANNELS32_SID (uint8)0x14
+
+/* Service ID for DIO commit Outputs (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_COMMIT_OUTPUTS_SID         (uint8)0x15
+
+/* Service IDs for the DIO software PWM, Dio_Pwm.h (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_PWM_INIT_SID               (uint8)0x16
+#define DIO_PWM_SET_DUTY_SID           (uint8)0x17
+#define DIO_PWM_UPDATE_SID             (uint8)0x18
+#define DIO_PWM_TICK_SID               (uint8)0x19
+
+/* Service IDs for the DIO pattern player, Dio_Pattern.h (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_PLAY_PATTERN_SID           (uint8)0x1A
+#define DIO_QUEUE_PATTERN_SID          (uint8)0x1B
+#define DIO_STOP_PATTERN_SID           (uint8)0x1C
+#define DIO_GET_PATTERN_STATUS_SID     (uint8)0x1D
+#define DIO_PATTERN_TICK_SID           (uint8)0x1E
+
+/* Service IDs for the DIO service statistics (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_GET_STATISTICS_SID         (uint8)0x1F
+#define DIO_RESET_STATISTICS_SID       (uint8)0x20
+
+/* Service IDs for the DIO register write trace, Dio_Trace.h (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_GET_TRACE_SID              (uint8)0x21
+#define DIO_CLEAR_TRACE_SID            (uint8)0x22
 
 /* Service ID for DIO GetVersionInfo */
 #define DIO_GET_VERSION_INFO_SID       (uint8)0x12
@@ -165,16 +268,95 @@ typedef uint8 Dio_LevelType;
 /* Type definition for Dio_PortLevelType used by the DIO APIs */
 typedef uint8 Dio_PortLevelType;
 
-typedef struct Dio_ConfigChannel {
-	/* Member contains the ID of the Port that this pin belongs to */
-	Dio_PortType Port_Id;
-	/* Member contains the ID of the pin*/
-	Dio_ChannelType Pin_Id;
-	/* Member contains the direction of the pin*/
-	Dio_Direction dir;
-	/* Member contains the level of the pint*/
-	Dio_PinLevelType level;
-} Dio_ConfigChannel;
+/* Type definition for Dio_ChannelsLevelType used by the 32-bit DIO APIs,
+ * bit n holds the level of channel n (PIN_A_0 = bit 0 .. PIN_D_7 = bit 31) */
+typedef uint32 Dio_ChannelsLevelType;
+
+/* Input snapshot taken by Dio_SampleInputs: the four PIN registers stored byte by byte,
+ * read back either per port or as one 32-bit image (bit n = channel n, little endian) */
+typedef union Dio_InputSnapshotType {
+	/* All the channels of the image (PIN_A_0 = bit 0 .. PIN_D_7 = bit 31) */
+	Dio_ChannelsLevelType Channels;
+	/* One byte per port, indexed by (Port_Id - PORTA_ID) */
+	uint8 Ports[DIO_IMAGE_PORTS];
+} Dio_InputSnapshotType;
+
+/* Memory class of the post-build configuration tables (Dio_ConfigurationSet, Dio_ChannelGroups)
+ * and of the pointers to them taken by the DIO APIs */
+#if (DIO_CONFIG_IN_FLASH == STD_ON)
+#define DIO_CONFIG_CONST               const FLASH
+#else
+#define DIO_CONFIG_CONST               const
+#endif
+
+/* Data Structure of a DIO channel group: several adjoining channels of one port
+ * that are read or written together with a single register access.
+ */
+typedef struct Dio_ChannelGroupType {
+	/* Member contains the mask which defines the positions of the channel group */
+	uint8 mask;
+	/* Member contains the position of the channel group on the port, counted from the LSB */
+	uint8 offset;
+	/* Member contains the ID of the Port that this group belongs to */
+	Dio_PortType port;
+} Dio_ChannelGroupType;
+
+/* Data Structure of the configuration of one port, one bit per channel (bit n = PINn) */
+typedef struct Dio_PortConfigType {
+	/* Member contains the mask of the configured channels of the port */
+	uint8 Configured;
+	/* Member contains the direction of the configured channels (1 = OUTPUT) */
+	uint8 Direction;
+	/* Member contains the initial level of the configured output channels (1 = STD_HIGH) */
+	uint8 Level;
+	/* Member contains the internal pull-up of the configured input channels (1 = enabled) */
+	uint8 PullUp;
+} Dio_PortConfigType;
+
+/* Bit of a channel (PIN0_ID .. PIN7_ID or PIN_A_0 .. PIN_D_7) inside Dio_PortConfigType */
+#define DIO_CHANNEL_BIT(CHANNEL)       ((uint8)(1U << ((CHANNEL) % NUM_OF_PINS_IN_SINGLE_PORT)))
+
+#if (DIO_NOTIFICATION_API == STD_ON)
+/* Edge notification callback: called from Dio_MainFunction with the global ID of the
+ * channel (PIN_A_0 .. PIN_D_7) and its new level */
+typedef void (*Dio_NotificationType)(Dio_ChannelType Channel_Id, Dio_LevelType Level);
+
+/* Data Structure of the edge notification of one channel */
+typedef struct Dio_ChannelNotificationType {
+	/* Global ID of the channel (PIN_A_0 .. PIN_D_7) */
+	Dio_ChannelType Channel;
+	/* Callback of the channel */
+	Dio_NotificationType Callback;
+} Dio_ChannelNotificationType;
+
+/* Data Structure of the edge notifications of all the channels */
+typedef struct Dio_NotificationConfigType {
+	/* Per port mask of the channels notified on a rising edge (bit n = PINn) */
+	uint8 Rising[DIO_IMAGE_PORTS];
+	/* Per port mask of the channels notified on a falling edge (bit n = PINn) */
+	uint8 Falling[DIO_IMAGE_PORTS];
+	/* Notified channels only, sorted by channel ID (NULL_PTR when no channel is notified) */
+	DIO_CONFIG_CONST Dio_ChannelNotificationType *Channels;
+	/* Number of entries of Channels */
+	uint8 Count;
+} Dio_NotificationConfigType;
+#endif
+
+#if (DIO_PROFILING == STD_ON)
+/* Statistics of one service (DIO_PROFILING), the counters saturate at 0xFFFF. Durations are
+ * measured in clock ticks: Timer1 counts on the target (CPU cycles with prescaler 1), ns on
+ * the host build */
+typedef struct Dio_ServiceStatisticsType {
+	/* Number of calls */
+	uint16 Calls;
+	/* Number of calls rejected by the error checks of the service (mostly DIO_DEV_ERROR_DETECT) */
+	uint16 Errors;
+	/* Longest call */
+	uint16 MaxTicks;
+	/* Calls per duration, bin n: below (DIO_PROFILING_BIN0_TICKS << n), last bin: the rest */
+	uint16 Histogram[DIO_PROFILING_BINS];
+} Dio_ServiceStatisticsType;
+#endif
 
 /* Data Structure required for initializing the Dio Driver
 @brief This structure contains all post-build configurable parameters of the DIO driver. 
@@ -182,7 +364,12 @@ A pointer to this structure is passed to the DIO driver initialization function
 configuration
  */
 typedef struct Dio_ConfigType {
-	const Dio_ConfigChannel *channels[DIO_CONFIGURED_CHANNLES];
+	/* Bit packed configuration of each port, indexed by (Port_Id - PORTA_ID) */
+	Dio_PortConfigType ports[DIO_CONFIGURED_PORTS];
+#if (DIO_NOTIFICATION_API == STD_ON)
+	/* Edge notifications dispatched by Dio_MainFunction */
+	Dio_NotificationConfigType Notification;
+#endif
 } Dio_ConfigType;
 
 
@@ -201,7 +388,7 @@ typedef struct Dio_ConfigType {
  * Description: Function to Initialize the Dio module.
  * =============================================================================*/
 /* Function for DIO Initialization API */
-void Dio_Init(const Dio_ConfigType *ConfigPtr);
+void Dio_Init(DIO_CONFIG_CONST Dio_ConfigType *ConfigPtr);
 
 /* =============================================================================
  * Service Name: Dio_SetupPinrtDirection
@@ -229,7 +416,8 @@ void Dio_SetupChannelDirection(Dio_PortType Port_Id, Dio_ChannelType Channel_Id,
  * Parameters (input): None
  * Parameters (out): None
  * Return value: None
- * Description: Function to set the direction of a port.
+ * Description: Function to set the direction of all the pins of a port
+ *              (INPUT -> DDRx = 0x00, OUTPUT -> DDRx = 0xFF).
  * =============================================================================*/
 /* Function for DIO Setup Port Direction API */
 void Dio_SetupPortDirection(Dio_PortType Port_Id, Dio_Direction dir);
@@ -273,14 +461,34 @@ void Dio_WriteChannel(Dio_PortType Port_Id, Dio_ChannelType Pin_Id,
  * Service ID[hex]: 0x03
  *Sync/Async: Synchronous
  * Reentrancy: Reentrant
- * PortId ID of DIO Port Parameters (in): Level Value to be written
+ * Parameters (in): Port_Id - ID of DIO port.
+ *                  Level - Value to be written (bit n = pin n).
  * Parameters(inout):None
  * Parameters (out): None
  * Return value: None
  * Description: Service to set a value of the port
  * =============================================================================*/
 /* Function for DIO write Port API */
-void Dio_WritePort(Dio_PortType Port_Id, Dio_PinLevelType level);
+void Dio_WritePort(Dio_PortType Port_Id, Dio_PortLevelType Level);
+
+#if (DIO_MASKED_WRITE_PORT_API == STD_ON)
+/* =============================================================================
+ * Service Name: Dio_MaskedWritePort
+ * Service ID[hex]: 0x13
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Port_Id - ID of DIO port.
+ *                  Level - Value to be written (bit n = pin n).
+ *                  Mask - Pins to be written (bit n = pin n).
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Service to set the value of the pins of a port selected by Mask with a
+ *              single read-modify-write, the other pins keep their level.
+ * =============================================================================*/
+/* Function for DIO masked write Port API */
+void Dio_MaskedWritePort(Dio_PortType Port_Id, Dio_PortLevelType Level, Dio_PortLevelType Mask);
+#endif
 
 /* =============================================================================
  * Service Name: Dio_ReadPort
@@ -296,6 +504,165 @@ void Dio_WritePort(Dio_PortType Port_Id, Dio_PinLevelType level);
 /* Function for DIO read Port API */
 Dio_PortLevelType Dio_ReadPort(Dio_PortType Port_Id);
 
+/* =============================================================================
+ * Service Name: Dio_ReadChannelGroup
+ * Service ID[hex]: 0x04
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): ChannelGroupIdPtr - Pointer to ChannelGroup.
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: Dio_PortLevelType Level of a subset of the adjoining bits of a port
+ * Description: This Service reads a subset of the adjoining bits of a port.
+ * =============================================================================*/
+/* Function for DIO read Channel Group API */
+Dio_PortLevelType Dio_ReadChannelGroup(DIO_CONFIG_CONST Dio_ChannelGroupType *ChannelGroupIdPtr);
+
+/* =============================================================================
+ * Service Name: Dio_WriteChannelGroup
+ * Service ID[hex]: 0x05
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): ChannelGroupIdPtr - Pointer to ChannelGroup.
+ *                  Level - Value to be written.
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Service to set a subset of the adjoining bits of a port to a specified level
+ *              with a single read-modify-write of the port register.
+ * =============================================================================*/
+/* Function for DIO write Channel Group API */
+void Dio_WriteChannelGroup(DIO_CONFIG_CONST Dio_ChannelGroupType *ChannelGroupIdPtr, Dio_PortLevelType Level);
+
+/* =============================================================================
+ * Service Name: Dio_WriteChannels32
+ * Service ID[hex]: 0x09
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Mask - Channels to be written (bit n = channel n).
+ *                  Level - Levels to be written (bit n = channel n).
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Service to set the level of any set of channels of the device,
+ *              with at most one read-modify-write per port.
+ * =============================================================================*/
+/* Function for DIO write Channels32 API */
+void Dio_WriteChannels32(Dio_ChannelsLevelType Mask, Dio_ChannelsLevelType Level);
+
+/* =============================================================================
+ * Service Name: Dio_ReadChannels32
+ * Service ID[hex]: 0x0A
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): None
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: Dio_ChannelsLevelType Level of all the channels of PORTA .. PORTD (bit n = channel n)
+ * Description: Function to return the physical level of all the channels of PORTA .. PORTD.
+ * =============================================================================*/
+/* Function for DIO read Channels32 API */
+Dio_ChannelsLevelType Dio_ReadChannels32(void);
+
+/* =============================================================================
+ * Service Name: Dio_FlipChannels32
+ * Service ID[hex]: 0x0B
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Mask - Channels to be flipped (bit n = channel n).
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Service to flip the level of any set of channels of the device,
+ *              with at most one read-modify-write per port.
+ * =============================================================================*/
+/* Function for DIO flip Channels32 API */
+void Dio_FlipChannels32(Dio_ChannelsLevelType Mask);
+
+/* =============================================================================
+ * Service Name: Dio_SampleInputs
+ * Service ID[hex]: 0x0C
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): None
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: Dio_ChannelsLevelType The new snapshot (bit n = channel n)
+ * Description: Function to latch PINA .. PIND back to back into the input snapshot,
+ *              so all the channels of one control cycle are sampled at the same instant.
+ * =============================================================================*/
+/* Function for DIO sample Inputs API */
+Dio_ChannelsLevelType Dio_SampleInputs(void);
+
+/* =============================================================================
+ * Service Name: Dio_ReadSampledChannel
+ * Service ID[hex]: 0x0D
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Channel_Id - ID of DIO channel (PIN_A_0 .. PIN_D_7).
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: Dio_LevelType
+ * 				 STD_HIGH The level of the channel in the last snapshot is STD_HIGH
+ * 				 STD_LOW The level of the channel in the last snapshot is STD_LOW
+ * Description: Function to return the level of a channel from the snapshot taken by the
+ *              last Dio_SampleInputs call (one byte load and one mask, no register access).
+ * =============================================================================*/
+/* Function for DIO read Sampled Channel API */
+Dio_LevelType Dio_ReadSampledChannel(Dio_ChannelType Channel_Id);
+
+#if ((DIO_DEBOUNCE_API == STD_ON) || (DIO_NOTIFICATION_API == STD_ON))
+/* =============================================================================
+ * Service Name: Dio_MainFunction
+ * Service ID[hex]: 0x0E
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): None
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Cyclic function (to be called with a fixed period) sampling and debouncing
+ *              all the channels. A channel takes a new debounced level after
+ *              DIO_DEBOUNCE_SAMPLES consecutive samples at that level.
+ *              Then calls the configured edge notifications of the channels that changed
+ *              (debounced level if DIO_DEBOUNCE_API is enabled, otherwise sampled level).
+ * =============================================================================*/
+/* Function for DIO Main Function API */
+void Dio_MainFunction(void);
+#endif
+
+#if (DIO_DEBOUNCE_API == STD_ON)
+/* =============================================================================
+ * Service Name: Dio_ReadDebouncedChannel
+ * Service ID[hex]: 0x0F
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Channel_Id - ID of DIO channel (PIN_A_0 .. PIN_D_7).
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: Dio_LevelType
+ * 				 STD_HIGH The debounced level of the channel is STD_HIGH
+ * 				 STD_LOW The debounced level of the channel is STD_LOW
+ * Description: Function to return the debounced level of a channel.
+ * =============================================================================*/
+/* Function for DIO read Debounced Channel API */
+Dio_LevelType Dio_ReadDebouncedChannel(Dio_ChannelType Channel_Id);
+
+/* =============================================================================
+ * Service Name: Dio_ReadDebouncedChannels32
+ * Service ID[hex]: 0x14
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): None
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: Dio_ChannelsLevelType Debounced level of all the channels (bit n = channel n)
+ * Description: Function to return the debounced level of all the channels of PORTA .. PORTD.
+ * =============================================================================*/
+/* Function for DIO read Debounced Channels32 API */
+Dio_ChannelsLevelType Dio_ReadDebouncedChannels32(void);
+#endif
+
 /* =============================================================================
  * Service Name:  Dio_FlipChannel
  * Service ID[hex]: 0x11
@@ -305,12 +672,64 @@ Dio_PortLevelType Dio_ReadPort(Dio_PortType Port_Id);
  * 				    Pin_Id - ID of DIO pin.
  * Parameters (input): None
  * Parameters (out): None
- * Return value: None
+ * Return value: Dio_LevelType
+ * 				 STD_HIGH The physical level of the corresponding Pin is STD_HIGH
+ * 				 STD_LOW The physical level of the corresponding Pin is STD_LOW
  * Description: Service to flip (change from 1 to 0 or from 0 to 1) the level of a channel and return
  *              the level of the channel after flip.
  * =============================================================================*/
 /* Function for DIO flip channel API */
-void  Dio_FlipChannel(Dio_PortType Port_Id, Dio_ChannelType Channel_Id);
+Dio_LevelType Dio_FlipChannel(Dio_PortType Port_Id, Dio_ChannelType Channel_Id);
+
+#if (DIO_DEFERRED_WRITE == STD_ON)
+/* =============================================================================
+ * Service Name: Dio_CommitOutputs
+ * Service ID[hex]: 0x15
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): None
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to push the output shadows written since the last commit to
+ *              the PORT registers, with one store per dirty port. With DIO_DEFERRED_WRITE the
+ *              write / flip APIs only update the shadows, so all the outputs of a control
+ *              step change together when this function is called.
+ * =============================================================================*/
+/* Function for DIO commit Outputs API */
+void Dio_CommitOutputs(void);
+#endif
+
+#if (DIO_PROFILING == STD_ON)
+/* =============================================================================
+ * Service Name: Dio_GetStatistics
+ * Service ID[hex]: 0x1F
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): ServiceId - DIO_*_SID of a service of Dio.c (below DIO_PROFILING_SERVICES).
+ * Parameters (input): None
+ * Parameters (out): Statistics - Copy of the statistics of the service.
+ * Return value: Std_ReturnType E_OK / E_NOT_OK (invalid ServiceId or pointer)
+ * Description: Function to read the call count, the error count and the duration
+ *              histogram of a service. Timer1 shall run (prescaler 1 for CPU cycles).
+ * =============================================================================*/
+/* Function for DIO get Statistics API */
+Std_ReturnType Dio_GetStatistics(uint8 ServiceId, Dio_ServiceStatisticsType *Statistics);
+
+/* =============================================================================
+ * Service Name: Dio_ResetStatistics
+ * Service ID[hex]: 0x20
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): None
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to clear the statistics of all the services.
+ * =============================================================================*/
+/* Function for DIO reset Statistics API */
+void Dio_ResetStatistics(void);
+#endif
 
 /* =============================================================================
  * Service Name: Dio_GetVersionInfo
@@ -328,11 +747,183 @@ void  Dio_FlipChannel(Dio_PortType Port_Id, Dio_ChannelType Channel_Id);
 void Dio_GetVersionInfo(Std_VersionInfoType *versioninfo);
 #endif
 
+/* =============================================================================
+ *                         INLINE FAST PATH APIs
+ * =============================================================================*/
+#if (DIO_INLINE_API == STD_ON)
+
+/* The fast path touches the registers directly from the caller */
+#include "MemMap.h"
+#include "SchM_Dio.h"
+
+/* One test of the PORT / PIN register chains below per port of the device (DIO_DEVICE_PORTS) */
+#define DIO_INLINE_PORT_ENTRY(Port_Id, L)   ((Port_Id) == PORT##L##_ID) ? &PORT##L :
+#define DIO_INLINE_PIN_ENTRY(Port_Id, L)    ((Port_Id) == PORT##L##_ID) ? &PIN##L :
+
+/* PORT register of a port ID known at compile time (folds to a constant address) */
+#define DIO_INLINE_PORT_REG(Port_Id) \
+	(DIO_DEVICE_PORTS(DIO_INLINE_PORT_ENTRY, Port_Id) &PORTA)
+
+/* Single instruction set / clear of a bit of an I/O register in the sbi/cbi range,
+ * used on the target so the write stays atomic at any optimization level */
+#if (defined(__AVR__) && !defined(DIO_HOST_BACKEND))
+#define DIO_INLINE_IO_ADDR(REG_PTR)    (DIO_REG_ADDRESS(REG_PTR) - 0x20U)
+#define DIO_INLINE_SBI(REG_PTR, BIT) \
+	__asm__ __volatile__ ("sbi %0, %1" : : "I" (DIO_INLINE_IO_ADDR(REG_PTR)), "I" (BIT) : "memory")
+#define DIO_INLINE_CBI(REG_PTR, BIT) \
+	__asm__ __volatile__ ("cbi %0, %1" : : "I" (DIO_INLINE_IO_ADDR(REG_PTR)), "I" (BIT) : "memory")
+#else
+#define DIO_INLINE_SBI(REG_PTR, BIT)   DIO_REG_WRITE((REG_PTR), (uint8)(DIO_REG_READ(REG_PTR) | (1U << (BIT))))
+#define DIO_INLINE_CBI(REG_PTR, BIT)   DIO_REG_WRITE((REG_PTR), (uint8)(DIO_REG_READ(REG_PTR) & ~(1U << (BIT))))
+#endif
+
+/* PIN register of a port ID known at compile time (folds to a constant address) */
+#define DIO_INLINE_PIN_REG(Port_Id) \
+	(DIO_DEVICE_PORTS(DIO_INLINE_PIN_ENTRY, Port_Id) &PINA)
+
+/* TRUE when all the arguments are compile-time constants, the port is valid and the channel
+ * is one of its pins (local ID, or global ID of this port); anything else goes to the API */
+#define DIO_INLINE_IS_CONST(Port_Id, Channel_Id) \
+	(__builtin_constant_p(Port_Id) && __builtin_constant_p(Channel_Id) \
+	 && ((uint8)((Port_Id) - PORTA_ID) < DIO_CONFIGURED_PORTS) \
+	 && (((Channel_Id) < NUM_OF_PINS_IN_SINGLE_PORT) \
+	  || (((Channel_Id) / NUM_OF_PINS_IN_SINGLE_PORT) == (uint8)((Port_Id) - PORTA_ID))))
+
+/* TRUE when an output can be written straight to the PORT register; with deferred writes
+ * the outputs always go through the shadows of Dio.c, and with the trace every write is
+ * recorded by Dio_TraceWrite, so the fast paths just call the APIs */
+#if ((DIO_DEFERRED_WRITE == STD_ON) || (DIO_TRACE == STD_ON))
+#define DIO_INLINE_IS_CONST_OUTPUT(Port_Id, Channel_Id)    (0)
+#else
+#define DIO_INLINE_IS_CONST_OUTPUT(Port_Id, Channel_Id)    DIO_INLINE_IS_CONST(Port_Id, Channel_Id)
+#endif
+
+/* =============================================================================
+ * Service Name: Dio_WriteChannelFast
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Port_Id - ID of DIO port.
+ * 				    Channel_Id - ID of DIO pin.
+ *                  level - Value to be written.
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Same as Dio_WriteChannel. With constant arguments it compiles to a
+ *              single sbi/cbi instruction (no call, no development error checks, atomic
+ *              without an interrupt lock), otherwise it calls Dio_WriteChannel.
+ *              A PORT register out of the sbi/cbi range (extended I/O ports of the larger
+ *              devices) gets an lds/or/sts sequence inside the Dio_PortAccess exclusive area.
+ * =============================================================================*/
+FORCE_INLINE void Dio_WriteChannelFast(Dio_PortType Port_Id, Dio_ChannelType Channel_Id, Dio_PinLevelType level) {
+	if (DIO_INLINE_IS_CONST_OUTPUT(Port_Id, Channel_Id) && __builtin_constant_p(level)) {
+		if (DIO_REG_IS_BIT_ADDRESSABLE(DIO_INLINE_PORT_REG(Port_Id))) {
+			if (level == STD_HIGH) {
+				DIO_INLINE_SBI(DIO_INLINE_PORT_REG(Port_Id), Channel_Id % NUM_OF_PINS_IN_SINGLE_PORT);
+			} else if (level == STD_LOW) {
+				DIO_INLINE_CBI(DIO_INLINE_PORT_REG(Port_Id), Channel_Id % NUM_OF_PINS_IN_SINGLE_PORT);
+			} else {
+				/* Do Nothing */
+			}
+		} else {
+			volatile uint8 *Port_Ptr = DIO_INLINE_PORT_REG(Port_Id);
+			uint8 Mask = (uint8)(1U << (Channel_Id % NUM_OF_PINS_IN_SINGLE_PORT));
+
+			SchM_Enter_Dio_PortAccess();
+			if (level == STD_HIGH) {
+				DIO_REG_WRITE(Port_Ptr, (uint8)(DIO_REG_READ(Port_Ptr) | Mask));
+			} else if (level == STD_LOW) {
+				DIO_REG_WRITE(Port_Ptr, (uint8)(DIO_REG_READ(Port_Ptr) & (uint8)(~Mask)));
+			} else {
+				/* Do Nothing */
+			}
+			SchM_Exit_Dio_PortAccess();
+		}
+	} else {
+		Dio_WriteChannel(Port_Id, Channel_Id, level);
+	}
+}
+
+/* =============================================================================
+ * Service Name: Dio_ReadChannelFast
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Port_Id - ID of DIO port.
+ * 				    Channel_Id - ID of DIO pin.
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: Dio_LevelType STD_HIGH / STD_LOW
+ * Description: Same as Dio_ReadChannel. With constant arguments it compiles to a
+ *              single sbic/sbis skip test (in or lds for a PIN register out of the sbic
+ *              range), otherwise it calls Dio_ReadChannel.
+ * =============================================================================*/
+FORCE_INLINE Dio_LevelType Dio_ReadChannelFast(Dio_PortType Port_Id, Dio_ChannelType Channel_Id) {
+	Dio_LevelType output;
+
+	if (DIO_INLINE_IS_CONST(Port_Id, Channel_Id)) {
+		if ((DIO_REG_READ(DIO_INLINE_PIN_REG(Port_Id)) & (uint8)(1U << (Channel_Id % NUM_OF_PINS_IN_SINGLE_PORT))) != 0U) {
+			output = STD_HIGH;
+		} else {
+			output = STD_LOW;
+		}
+	} else {
+		output = Dio_ReadChannel(Port_Id, Channel_Id);
+	}
+	return output;
+}
+
+/* =============================================================================
+ * Service Name: Dio_FlipChannelFast
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Port_Id - ID of DIO port.
+ * 				    Channel_Id - ID of DIO pin.
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: Dio_LevelType level of the channel after flip (STD_HIGH / STD_LOW)
+ * Description: Same as Dio_FlipChannel. With constant arguments it compiles to an
+ *              in/eor/out sequence on the PORT register (lds/eor/sts in the extended I/O
+ *              space, inside the Dio_PortAccess exclusive area), otherwise it calls
+ *              Dio_FlipChannel.
+ *              An unused return value costs nothing.
+ * =============================================================================*/
+FORCE_INLINE Dio_LevelType Dio_FlipChannelFast(Dio_PortType Port_Id, Dio_ChannelType Channel_Id) {
+	Dio_LevelType output;
+
+	if (DIO_INLINE_IS_CONST_OUTPUT(Port_Id, Channel_Id)) {
+		volatile uint8 *Port_Ptr = DIO_INLINE_PORT_REG(Port_Id);
+		uint8 Mask = (uint8)(1U << (Channel_Id % NUM_OF_PINS_IN_SINGLE_PORT));
+		uint8 Latch;
+
+		SchM_Enter_Dio_PortAccess();
+		Latch = (uint8)(DIO_REG_READ(Port_Ptr) ^ Mask);
+		DIO_REG_WRITE(Port_Ptr, Latch);
+		SchM_Exit_Dio_PortAccess();
+
+		if ((Latch & Mask) != 0U) {
+			output = STD_HIGH;
+		} else {
+			output = STD_LOW;
+		}
+	} else {
+		output = Dio_FlipChannel(Port_Id, Channel_Id);
+	}
+	return output;
+}
+
+#endif /* DIO_INLINE_API == STD_ON */
+
 /* =============================================================================
  *                         EXTERNAL VARIABLES                                   
  * =============================================================================*/
 
 /* Extern PB structures to be used by Dio and other modules */
-extern const Dio_ConfigType Dio_ConfigurationSet;
+extern DIO_CONFIG_CONST Dio_ConfigType Dio_ConfigurationSet;
+
+/* Extern PB channel groups to be used with the Channel Group APIs */
+extern DIO_CONFIG_CONST Dio_ChannelGroupType Dio_ChannelGroups[DIO_CONFIGURED_GROUPS];
+
+#ifdef __cplusplus
+}
+#endif
 
 #endif /* DIO_H */
@@ -0,0 +1,277 @@
+/*===============================================================================
+ * Module: DIO																	*
+ * File Name: Dio.hpp															*
+ * Description: Header-only C++ template layer for AVR ATmega32/128/2560 - DIO	*
+ *              Pins, ports and channel groups are template parameters, so		*
+ *              every access folds to the same instructions as a hand-written	*
+ *              register access (sbi/cbi/sbic/in/out).							*
+ * Author: Mahmoud-Helmy														*
+ *==============================================================================*/
+/* =============================================================================
+ * 							   FILE GUARD
+ * =============================================================================*/
+#ifndef DIO_HPP
+#define DIO_HPP
+/* =============================================================================
+ * 								INCLUDES
+ * =============================================================================*/
+/* C APIs and configuration types shared with the template layer */
+#include "Dio.h"
+
+/* Registers of the DIO ports */
+#include "MemMap.h"
+
+/* Dio_PortAccess exclusive area around the read-modify-writes */
+#include "SchM_Dio.h"
+
+/* =============================================================================
+ * 								VERSION CHECK
+ * =============================================================================*/
+/* Software Version checking between MemMap.h and Dio.h files */
+#if ((DIO_REGS_SW_MAJOR_VERSION != DIO_SW_MAJOR_VERSION)\
+ ||  (DIO_REGS_SW_MINOR_VERSION != DIO_SW_MINOR_VERSION)\
+ ||  (DIO_REGS_SW_PATCH_VERSION != DIO_SW_PATCH_VERSION))
+  #error "The SW version of MemMap.h does not match the expected version"
+#endif
+
+/* The templates write the PORT registers, not the output shadows; with deferred writes the
+ * next Dio_CommitOutputs would overwrite those pins with the stale shadow of their port */
+#if (DIO_DEFERRED_WRITE == STD_ON)
+  #error "Dio.hpp cannot be used with DIO_DEFERRED_WRITE, use the C APIs and Dio_CommitOutputs"
+#endif
+
+namespace Dio {
+
+/* =============================================================================
+ * 						  CONFIGURATION ACCESS
+ * =============================================================================*/
+/* C++ has no __flash: with DIO_CONFIG_IN_FLASH the C post-build tables are read with LPM */
+#if (DIO_CONFIG_IN_FLASH == STD_ON) && defined(__AVR__)
+#define DIO_HPP_CONFIG_IN_FLASH        (STD_ON)
+#else
+#define DIO_HPP_CONFIG_IN_FLASH        (STD_OFF)
+#endif
+
+/* Reads one byte of a C post-build configuration table */
+inline uint8 ConfigRead(const uint8 &Field) {
+#if (DIO_HPP_CONFIG_IN_FLASH == STD_ON)
+	uint8 Value;
+	__asm__ ("lpm %0, Z" : "=r" (Value) : "z" (&Field));
+	return Value;
+#else
+	return Field;
+#endif
+}
+
+/* =============================================================================
+ * 							 PORT REGISTERS
+ * =============================================================================*/
+/* Registers of a port ID, one specialization per port of the device (DIO_DEVICE_PORTS) */
+template <Dio_PortType PortId>
+struct PortRegisters;
+
+#define DIO_HPP_PORT_REGISTERS(ARG, L) \
+	template <> \
+	struct PortRegisters<PORT##L##_ID> { \
+		static volatile uint8 &Port() { return PORT##L; } \
+		static volatile uint8 &Pin()  { return PIN##L; } \
+		static volatile uint8 &Ddr()  { return DDR##L; } \
+	};
+
+DIO_DEVICE_PORTS(DIO_HPP_PORT_REGISTERS, ~)
+
+#undef DIO_HPP_PORT_REGISTERS
+
+/* TRUE for a port ID of the device */
+#define DIO_HPP_VALID_PORT(PortId)     ((PortId >= PORTA_ID) && ((PortId - PORTA_ID) < DIO_CONFIGURED_PORTS))
+
+/* The single bit updates may use the sbi / cbi of the C fast path (DIO_INLINE_SBI / DIO_INLINE_CBI)
+ * on the target, when the calls are inlined and no write has to be recorded by DIO_TRACE */
+#if ((DIO_INLINE_API == STD_ON) && (DIO_TRACE == STD_OFF) && defined(__OPTIMIZE__) \
+ && defined(__AVR__) && !defined(DIO_HOST_BACKEND))
+#define DIO_HPP_SBI_CBI                (STD_ON)
+#else
+#define DIO_HPP_SBI_CBI                (STD_OFF)
+#endif
+
+/* TRUE when a register folds to a constant address of the sbi / cbi range */
+#define DIO_HPP_IS_CONST_BIT_ADDRESSABLE(REG_PTR) \
+	(__builtin_constant_p(DIO_REG_ADDRESS(REG_PTR)) && DIO_REG_IS_BIT_ADDRESSABLE(REG_PTR))
+
+/* Sets / clears one bit of a register: one sbi / cbi (atomic by itself) when allowed above,
+ * otherwise a read-modify-write through the register layer inside the Dio_PortAccess
+ * exclusive area (extended I/O ports, -O0, host backend, trace) */
+template <uint8 Bit>
+inline void SetBit(volatile uint8 *Reg) {
+#if (DIO_HPP_SBI_CBI == STD_ON)
+	if (DIO_HPP_IS_CONST_BIT_ADDRESSABLE(Reg)) {
+		DIO_INLINE_SBI(Reg, Bit);
+	} else
+#endif
+	{
+		SchM_Enter_Dio_PortAccess();
+		DIO_REG_WRITE(Reg, (uint8)(DIO_REG_READ(Reg) | (uint8)(1U << Bit)));
+		SchM_Exit_Dio_PortAccess();
+	}
+}
+
+template <uint8 Bit>
+inline void ClearBit(volatile uint8 *Reg) {
+#if (DIO_HPP_SBI_CBI == STD_ON)
+	if (DIO_HPP_IS_CONST_BIT_ADDRESSABLE(Reg)) {
+		DIO_INLINE_CBI(Reg, Bit);
+	} else
+#endif
+	{
+		SchM_Enter_Dio_PortAccess();
+		DIO_REG_WRITE(Reg, (uint8)(DIO_REG_READ(Reg) & (uint8)~(1U << Bit)));
+		SchM_Exit_Dio_PortAccess();
+	}
+}
+
+/* =============================================================================
+ * 								 PORT
+ * =============================================================================*/
+/* Whole 8-bit port, e.g. Dio::Port<PORTA_ID>::Write(0x55) */
+template <Dio_PortType PortId>
+struct Port {
+	static_assert(DIO_HPP_VALID_PORT(PortId), "Dio::Port: invalid port ID");
+
+	typedef PortRegisters<PortId> Registers;
+
+	/* Sets the direction of all the pins of the port (bit = 1 -> output) */
+	static void SetDirection(uint8 OutputMask) { DIO_REG_WRITE(&Registers::Ddr(), OutputMask); }
+
+	/* Writes the level of all the pins of the port */
+	static void Write(Dio_PortLevelType Level) { DIO_REG_WRITE(&Registers::Port(), Level); }
+
+	/* Writes the level of the pins selected by Mask with a single read-modify-write, through the
+	 * register layer as Dio_MaskedWritePort (recorded by DIO_TRACE and by the host backend) */
+	static void Write(Dio_PortLevelType Level, uint8 Mask) {
+		volatile uint8 *Reg = &Registers::Port();
+
+		SchM_Enter_Dio_PortAccess();
+		DIO_REG_WRITE(Reg, (uint8)((DIO_REG_READ(Reg) & (uint8)~Mask) | (uint8)(Level & Mask)));
+		SchM_Exit_Dio_PortAccess();
+	}
+
+	/* Returns the physical level of all the pins of the port */
+	static Dio_PortLevelType Read() { return DIO_REG_READ(&Registers::Pin()); }
+};
+
+/* =============================================================================
+ * 								  PIN
+ * =============================================================================*/
+/* Single channel, e.g. Dio::Pin<PORTC_ID, PIN2_ID>::Set()
+ * ChannelId may be local to the port (PIN2_ID) or global (PIN_C_2).
+ */
+template <Dio_PortType PortId, Dio_ChannelType ChannelId>
+struct Pin {
+	static_assert(DIO_HPP_VALID_PORT(PortId), "Dio::Pin: invalid port ID");
+	static_assert((ChannelId < NUM_OF_PINS_IN_SINGLE_PORT)
+			|| ((ChannelId / NUM_OF_PINS_IN_SINGLE_PORT) == (PortId - PORTA_ID)),
+			"Dio::Pin: channel does not belong to the port");
+
+	typedef PortRegisters<PortId> Registers;
+
+	/* Global channel ID (PIN_A_0 .. last pin of the device) */
+	static constexpr Dio_ChannelType Channel =
+			(Dio_ChannelType)(((PortId - PORTA_ID) * NUM_OF_PINS_IN_SINGLE_PORT) + (ChannelId % NUM_OF_PINS_IN_SINGLE_PORT));
+
+	/* Bit of the channel inside the port registers, and its mask */
+	static constexpr uint8 Bit = (uint8)(ChannelId % NUM_OF_PINS_IN_SINGLE_PORT);
+	static constexpr uint8 Mask = (uint8)(1U << Bit);
+
+	static void SetOutput() { SetBit<Bit>(&Registers::Ddr()); }
+	static void SetInput()  { ClearBit<Bit>(&Registers::Ddr()); }
+
+	/* Constant single bit updates, one sbi/cbi on the target when optimized (see SetBit) */
+	static void Set()    { SetBit<Bit>(&Registers::Port()); }
+	static void Clear()  { ClearBit<Bit>(&Registers::Port()); }
+
+	/* in/eor/out (lds/eor/sts in the extended I/O space), inside the Dio_PortAccess exclusive area, returns the level after the flip
+	 * (same as Dio_FlipChannel) */
+	static Dio_LevelType Toggle() {
+		volatile uint8 *Reg = &Registers::Port();
+		uint8 Latch;
+
+		SchM_Enter_Dio_PortAccess();
+		Latch = (uint8)(DIO_REG_READ(Reg) ^ Mask);
+		DIO_REG_WRITE(Reg, Latch);
+		SchM_Exit_Dio_PortAccess();
+		return ((Latch & Mask) != 0U) ? (Dio_LevelType)STD_HIGH : (Dio_LevelType)STD_LOW;
+	}
+
+	static void Write(Dio_LevelType Level) {
+		if (Level == STD_HIGH) {
+			Set();
+		} else {
+			Clear();
+		}
+	}
+
+	/* Returns the physical level of the pin */
+	static Dio_LevelType Read() {
+		return ((DIO_REG_READ(&Registers::Pin()) & Mask) != 0U) ? (Dio_LevelType)STD_HIGH : (Dio_LevelType)STD_LOW;
+	}
+
+	/* Applies the configuration of this pin from the C post-build set shared with Dio_Init */
+	static void Init(const Dio_ConfigType &ConfigSet = Dio_ConfigurationSet) {
+		const Dio_PortConfigType &PortConfig = ConfigSet.ports[PortId - PORTA_ID];
+
+		if ((ConfigRead(PortConfig.Configured) & Mask) != 0U) {
+			if ((ConfigRead(PortConfig.Direction) & Mask) != 0U) {
+				Write(((ConfigRead(PortConfig.Level) & Mask) != 0U) ? (Dio_LevelType)STD_HIGH : (Dio_LevelType)STD_LOW);
+				SetOutput();
+			} else {
+				Write(((ConfigRead(PortConfig.PullUp) & Mask) != 0U) ? (Dio_LevelType)STD_HIGH : (Dio_LevelType)STD_LOW);
+				SetInput();
+			}
+		}
+	}
+};
+
+/* =============================================================================
+ * 							   PIN GROUP
+ * =============================================================================*/
+/* Adjoining channels of one port, e.g. Dio::PinGroup<PORTD_ID, 0xF0, 4>::Write(0x0A) */
+template <Dio_PortType PortId, uint8 GroupMask, uint8 Offset>
+struct PinGroup {
+	static_assert(DIO_HPP_VALID_PORT(PortId), "Dio::PinGroup: invalid port ID");
+	static_assert(GroupMask != 0U, "Dio::PinGroup: empty mask");
+	static_assert(Offset < NUM_OF_PINS_IN_SINGLE_PORT, "Dio::PinGroup: offset out of the port");
+	static_assert((GroupMask & ((1U << Offset) - 1U)) == 0U, "Dio::PinGroup: mask starts below the offset");
+	static_assert((((GroupMask >> Offset) + 1U) & (GroupMask >> Offset)) == 0U, "Dio::PinGroup: channels are not adjoining");
+
+	typedef PortRegisters<PortId> Registers;
+
+#if (DIO_HPP_CONFIG_IN_FLASH == STD_OFF)
+	/* Same group as a C descriptor, to be passed to Dio_ReadChannelGroup / Dio_WriteChannelGroup
+	 * (not available when the C APIs expect the descriptors in flash) */
+	static constexpr Dio_ChannelGroupType Descriptor = { GroupMask, Offset, PortId };
+#endif
+
+	/* Writes the group with a single read-modify-write of the PORT register */
+	static void Write(Dio_PortLevelType Level) {
+		volatile uint8 *Reg = &Registers::Port();
+		uint8 Value = (uint8)((uint8)(Level << Offset) & GroupMask);
+
+		SchM_Enter_Dio_PortAccess();
+		DIO_REG_WRITE(Reg, (uint8)((DIO_REG_READ(Reg) & (uint8)~GroupMask) | Value));
+		SchM_Exit_Dio_PortAccess();
+	}
+
+	/* Returns the physical level of the group, shifted down to bit 0 */
+	static Dio_PortLevelType Read() {
+		return (Dio_PortLevelType)((DIO_REG_READ(&Registers::Pin()) & GroupMask) >> Offset);
+	}
+};
+
+#if (DIO_HPP_CONFIG_IN_FLASH == STD_OFF)
+template <Dio_PortType PortId, uint8 GroupMask, uint8 Offset>
+constexpr Dio_ChannelGroupType PinGroup<PortId, GroupMask, Offset>::Descriptor;
+#endif
+
+} /* namespace Dio */
+
+#endif /* DIO_HPP */
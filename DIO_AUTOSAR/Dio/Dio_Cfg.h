@@ -4,6 +4,7 @@
  * Description: Pre-Compile Configuration Header file for AVR ATmega32 Microcontroller- Dio Driver		*
  * Author: Mahmoud-Helmy																				*
  *======================================================================================================*/
+/* Generated by Generator/DioGen.py from Dio_Config.json -- edit the description and regenerate */
 /* =====================================================================================================
  * 											 FILE GUARD
  * =====================================================================================================*/
@@ -42,12 +43,69 @@
 /* =====================================================================================================
  * 								    Configuration Parameters
  * =====================================================================================================*/
-/* Pre-compile option for Development Error Detect */
+/* Pre-compile option for Development Error Detect
+ * (may be overridden from the command line, e.g. by the benchmark build) */
+#ifndef DIO_DEV_ERROR_DETECT
 #define DIO_DEV_ERROR_DETECT                (STD_OFF)
+#endif
 
 /* Pre-compile option for Version Info API */
 #define DIO_VERSION_INFO_API                (STD_ON)
 
+/* Pre-compile option for Masked Write Port API */
+#define DIO_MASKED_WRITE_PORT_API           (STD_ON)
+
+/* Pre-compile option to keep the post-build configuration tables in flash (read with LPM)
+ * instead of copying them to SRAM at startup */
+#define DIO_CONFIG_IN_FLASH                 (STD_ON)
+
+/* Pre-compile option for the inline fast path APIs (Dio_WriteChannelFast, ...) in Dio.h */
+#define DIO_INLINE_API                      (STD_ON)
+
+/* Pre-compile option for interrupt safe read-modify-write of the PORT / DDR registers
+ * (see SchM_Dio.h for the worst case interrupt lock time) */
+#define DIO_ATOMIC_ACCESS                   (STD_ON)
+
+/* Pre-compile option for the input debouncing (Dio_MainFunction, Dio_ReadDebouncedChannel, ...) */
+#define DIO_DEBOUNCE_API                    (STD_ON)
+
+/* Number of consecutive equal samples (1 .. 8) before a debounced input takes a new level */
+#define DIO_DEBOUNCE_SAMPLES                (4U)
+
+/* Pre-compile option for the edge notifications called from Dio_MainFunction */
+#define DIO_NOTIFICATION_API                (STD_OFF)
+
+/* Pre-compile option for the deferred outputs: the write APIs update shadows
+ * pushed to the ports by Dio_CommitOutputs */
+#define DIO_DEFERRED_WRITE                  (STD_OFF)
+
+/* Pre-compile option for the bit-angle modulation software PWM (Dio_Pwm.h) */
+#define DIO_PWM_API                         (STD_OFF)
+
+/* Duty resolution of the software PWM in bits, one timer interrupt per bit (1 .. 8) */
+#define DIO_PWM_RESOLUTION_BITS             (8U)
+
+/* Pre-compile option for the flash pattern players (Dio_Pattern.h) */
+#define DIO_PATTERN_API                     (STD_OFF)
+
+/* Pre-compile option for the per service statistics (Dio_GetStatistics) */
+#define DIO_PROFILING                       (STD_OFF)
+
+/* Number of bins of the duration histograms, bin n < (DIO_PROFILING_BIN0_TICKS << n) (1 .. 11) */
+#define DIO_PROFILING_BINS                  (6U)
+
+/* Pre-compile option for the register write trace (Dio_GetTrace) */
+#define DIO_TRACE                           (STD_OFF)
+
+/* Number of records of the register write trace, 6 bytes each (power of 2, 2 .. 128) */
+#define DIO_TRACE_RECORDS                   (32U)
+
+/* Target device, selects the register map of MemMap.h (ports, register addresses) */
+#define DIO_DEVICE_ATMEGA32                 (0U)
+#define DIO_DEVICE_ATMEGA128                (1U)
+#define DIO_DEVICE_ATMEGA2560               (2U)
+#define DIO_DEVICE                          (DIO_DEVICE_ATMEGA32)
+
 
 #define INPUT                              (uint8)0x00
 #define OUTPUT                             (uint8)0x01
@@ -61,6 +119,12 @@
 #define DIO_CONFIGURED_CHANNLES             (32U) /* 4 PORTS * 8 PINS = 32 Channels*/
 #define NUM_OF_PINS_IN_SINGLE_PORT			(8U)
 
+/* Number of the configured Dio Channel Groups */
+#define DIO_CONFIGURED_GROUPS               (1U)
+
+/* Channel Group Handles (to be passed to Dio_ReadChannelGroup / Dio_WriteChannelGroup) */
+#define DIO_GROUP_NIBBLE_BUS                (&Dio_ChannelGroups[0]) /* PIN_D_4 .. PIN_D_7 */
+
 
 #define PORTA_ID                          (uint8)0x01
 #define PORTB_ID                          (uint8)0x02
@@ -121,4 +185,28 @@
 #define    PIN_D_6         30 // 6
 #define    PIN_D_7         31 // 7
 
+/* Configured Channel Handles: <name>_PORT / <name>_PIN for the port based APIs,
+ * <name> (0..31) for the channel based APIs */
+#define    DIO_CHANNEL_LED_0                PIN_C_0    /* OUTPUT */
+#define    DIO_CHANNEL_LED_0_PORT           PORTC_ID
+#define    DIO_CHANNEL_LED_0_PIN            PIN0_ID
+#define    DIO_CHANNEL_LED_1                PIN_C_1    /* OUTPUT */
+#define    DIO_CHANNEL_LED_1_PORT           PORTC_ID
+#define    DIO_CHANNEL_LED_1_PIN            PIN1_ID
+#define    DIO_CHANNEL_LED_2                PIN_C_2    /* OUTPUT */
+#define    DIO_CHANNEL_LED_2_PORT           PORTC_ID
+#define    DIO_CHANNEL_LED_2_PIN            PIN2_ID
+#define    DIO_CHANNEL_BUS_D4               PIN_D_4    /* OUTPUT */
+#define    DIO_CHANNEL_BUS_D4_PORT          PORTD_ID
+#define    DIO_CHANNEL_BUS_D4_PIN           PIN4_ID
+#define    DIO_CHANNEL_BUS_D5               PIN_D_5    /* OUTPUT */
+#define    DIO_CHANNEL_BUS_D5_PORT          PORTD_ID
+#define    DIO_CHANNEL_BUS_D5_PIN           PIN5_ID
+#define    DIO_CHANNEL_BUS_D6               PIN_D_6    /* OUTPUT */
+#define    DIO_CHANNEL_BUS_D6_PORT          PORTD_ID
+#define    DIO_CHANNEL_BUS_D6_PIN           PIN6_ID
+#define    DIO_CHANNEL_BUS_D7               PIN_D_7    /* OUTPUT */
+#define    DIO_CHANNEL_BUS_D7_PORT          PORTD_ID
+#define    DIO_CHANNEL_BUS_D7_PIN           PIN7_ID
+
 #endif /* DIO_CFG_H */
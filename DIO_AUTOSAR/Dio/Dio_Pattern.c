@@ -0,0 +1,306 @@
+/*===============================================================================
+ * Module: DIO																	*
+ * File Name: Dio_Pattern.c														*
+ * Description: Flash pattern player of the AVR ATmega32 Microcontroller -		*
+ *              DIO Driver														*
+ * Author: Mahmoud-Helmy														*
+ *==============================================================================*/
+/* =============================================================================
+ * 								 INCLUDES
+ * =============================================================================*/
+#include "Dio_Pattern.h"
+#include "MemMap.h"
+#include "SchM_Dio.h"
+#include "Dio_Trace.h"
+
+#if (DIO_PATTERN_API == STD_ON)
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+#include "../Det/Det.h"
+#endif
+
+/* =============================================================================
+ * 							 GLOBAL VARIABLES
+ * =============================================================================*/
+/* @struct Dio_PatternPlayerType: State of the pattern player of one port.
+ * @member Next: Next value to be written.
+ * @member Start: First value of the current buffer (DIO_PATTERN_REPEAT).
+ * @member Remaining: Values left in the current buffer.
+ * @member Length: Number of values of the current buffer.
+ * @member Queued: Buffer played after the current one (DIO_PATTERN_DOUBLE_BUFFER).
+ * @member QueuedLength: Number of values of the queued buffer, 0 when the queue is free.
+ * @member Rate: Dio_PatternTick calls per value.
+ * @member Countdown: Dio_PatternTick calls left before the next value.
+ * @member Mode: Dio_PatternModeType of the player.
+ * @member Active: TRUE while the player runs. The only field shared with Dio_PatternTick
+ *                 while it is written by the APIs: a player is set up while inactive and
+ *                 published with a single store of this flag.
+ */
+typedef struct Dio_PatternPlayerType {
+	const FLASH uint8 *Next;
+	const FLASH uint8 *Start;
+	uint16 Remaining;
+	uint16 Length;
+	const FLASH uint8 *Queued;
+	uint16 QueuedLength;
+	uint8 Rate;
+	uint8 Countdown;
+	Dio_PatternModeType Mode;
+	volatile boolean Active;
+} Dio_PatternPlayerType;
+
+/* One player per port, indexed by (Port_Id - PORTA_ID) */
+STATIC Dio_PatternPlayerType Dio_PatternPlayers[DIO_CONFIGURED_PORTS];
+
+/* PORT register lookup table indexed by (Port_Id - PORTA_ID), one entry per port of the device */
+STATIC volatile uint8 * const FLASH Dio_PatternPorts[DIO_CONFIGURED_PORTS] = {
+	DIO_DEVICE_PORTS(DIO_DEVICE_REG_ENTRY, PORT)
+};
+
+/* =============================================================================
+ * 								  APIs
+ * =============================================================================*/
+/* =============================================================================
+ * Service Name: Dio_PlayPattern
+ * Service ID[hex]: 0x1A
+ * Sync/Async: Asynchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Port_Id - ID of DIO port.
+ *                  Buffer - Port values in flash.
+ *                  Length - Number of values of Buffer.
+ *                  Rate - Dio_PatternTick calls per value.
+ *                  Mode - Mode of the player.
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: Std_ReturnType E_OK / E_NOT_OK
+ * Description: Function to start streaming a flash buffer to the PORT register of a port.
+ * =============================================================================*/
+Std_ReturnType Dio_PlayPattern(Dio_PortType Port_Id, const FLASH uint8 *Buffer, uint16 Length,
+		uint8 Rate, Dio_PatternModeType Mode) {
+	Std_ReturnType output = E_NOT_OK;
+	uint8 PortIndex = (uint8)(Port_Id - PORTA_ID);
+
+	/* Check if the used port is within the valid range */
+	if (DIO_CONFIGURED_PORTS <= PortIndex) {
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_PLAY_PATTERN_SID, DIO_E_PARAM_INVALID_PORT_ID);
+#endif
+	}
+	/* Check if input pointer is not Null pointer */
+	else if (NULL_PTR == Buffer) {
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_PLAY_PATTERN_SID, DIO_E_PARAM_POINTER);
+#endif
+	}
+	/* Check the length, the rate and the mode */
+	else if ((0U == Length) || (0U == Rate) || (DIO_PATTERN_DOUBLE_BUFFER < Mode)) {
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_PLAY_PATTERN_SID, DIO_E_PARAM_CONFIG);
+#endif
+	} else {
+		Dio_PatternPlayerType *Player = &Dio_PatternPlayers[PortIndex];
+
+		/* Stop the player, Dio_PatternTick does not touch an inactive player */
+		SchM_Enter_Dio_PortAccess();
+		Player->Active = FALSE;
+		SchM_Exit_Dio_PortAccess();
+
+		Player->Next = Buffer;
+		Player->Start = Buffer;
+		Player->Length = Length;
+		Player->QueuedLength = 0U;
+		Player->Rate = Rate;
+		Player->Countdown = 1U;
+		Player->Mode = Mode;
+		Player->Remaining = Length;
+
+		/* Publish the new pattern with one store */
+		SchM_Enter_Dio_PortAccess();
+		Player->Active = TRUE;
+		SchM_Exit_Dio_PortAccess();
+
+		output = E_OK;
+	}
+	return output;
+}
+
+/* =============================================================================
+ * Service Name: Dio_QueuePattern
+ * Service ID[hex]: 0x1B
+ * Sync/Async: Asynchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Port_Id - ID of DIO port.
+ *                  Buffer - Next port values in flash.
+ *                  Length - Number of values of Buffer.
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: Std_ReturnType E_OK / E_NOT_OK
+ * Description: Function to queue the next buffer of a double buffer pattern.
+ * =============================================================================*/
+Std_ReturnType Dio_QueuePattern(Dio_PortType Port_Id, const FLASH uint8 *Buffer, uint16 Length) {
+	Std_ReturnType output = E_NOT_OK;
+	uint8 PortIndex = (uint8)(Port_Id - PORTA_ID);
+
+	/* Check if the used port is within the valid range */
+	if (DIO_CONFIGURED_PORTS <= PortIndex) {
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_QUEUE_PATTERN_SID, DIO_E_PARAM_INVALID_PORT_ID);
+#endif
+	}
+	/* Check if input pointer is not Null pointer */
+	else if (NULL_PTR == Buffer) {
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_QUEUE_PATTERN_SID, DIO_E_PARAM_POINTER);
+#endif
+	}
+	/* Check the length */
+	else if (0U == Length) {
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_QUEUE_PATTERN_SID, DIO_E_PARAM_CONFIG);
+#endif
+	} else {
+		Dio_PatternPlayerType *Player = &Dio_PatternPlayers[PortIndex];
+
+		SchM_Enter_Dio_PortAccess();
+		/* Only a running double buffer player with a free queue takes the buffer */
+		if ((DIO_PATTERN_DOUBLE_BUFFER == Player->Mode) && (FALSE != Player->Active)
+				&& (0U == Player->QueuedLength)) {
+			Player->Queued = Buffer;
+			Player->QueuedLength = Length;
+			output = E_OK;
+		} else {
+			/* Do Nothing */
+		}
+		SchM_Exit_Dio_PortAccess();
+	}
+	return output;
+}
+
+/* =============================================================================
+ * Service Name: Dio_StopPattern
+ * Service ID[hex]: 0x1C
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Port_Id - ID of DIO port.
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to stop the pattern of a port, the port keeps its last value.
+ * =============================================================================*/
+void Dio_StopPattern(Dio_PortType Port_Id) {
+	uint8 PortIndex = (uint8)(Port_Id - PORTA_ID);
+
+	/* Check if the used port is within the valid range */
+	if (DIO_CONFIGURED_PORTS <= PortIndex) {
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_STOP_PATTERN_SID, DIO_E_PARAM_INVALID_PORT_ID);
+#endif
+	} else {
+		/* The queued buffer is dropped by the next Dio_PlayPattern */
+		SchM_Enter_Dio_PortAccess();
+		Dio_PatternPlayers[PortIndex].Active = FALSE;
+		SchM_Exit_Dio_PortAccess();
+	}
+}
+
+/* =============================================================================
+ * Service Name: Dio_GetPatternStatus
+ * Service ID[hex]: 0x1D
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Port_Id - ID of DIO port.
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: Dio_PatternStatusType
+ * Description: Function to return the state of the pattern player of a port.
+ * =============================================================================*/
+Dio_PatternStatusType Dio_GetPatternStatus(Dio_PortType Port_Id) {
+	Dio_PatternStatusType output = DIO_PATTERN_IDLE;
+	uint8 PortIndex = (uint8)(Port_Id - PORTA_ID);
+
+	/* Check if the used port is within the valid range */
+	if (DIO_CONFIGURED_PORTS <= PortIndex) {
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_GET_PATTERN_STATUS_SID, DIO_E_PARAM_INVALID_PORT_ID);
+#endif
+	} else {
+		const Dio_PatternPlayerType *Player = &Dio_PatternPlayers[PortIndex];
+
+		SchM_Enter_Dio_PortAccess();
+		if (FALSE == Player->Active) {
+			output = DIO_PATTERN_IDLE;
+		} else if ((DIO_PATTERN_DOUBLE_BUFFER == Player->Mode) && (0U == Player->QueuedLength)) {
+			output = DIO_PATTERN_QUEUE_FREE;
+		} else {
+			output = DIO_PATTERN_PLAYING;
+		}
+		SchM_Exit_Dio_PortAccess();
+	}
+	return output;
+}
+
+/* =============================================================================
+ * Service Name: Dio_PatternTick
+ * Service ID[hex]: 0x1E
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): None
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to write the due values of all the players, called from a
+ *              periodic timer ISR. All the due values are written first, the bookkeeping
+ *              follows, so the players do not delay each other by their bookkeeping: the
+ *              skew between two ports is the countdown and the write of the players in
+ *              between (a few cycles per port, one Dio_TraceWrite call each with DIO_TRACE).
+ * =============================================================================*/
+void Dio_PatternTick(void) {
+	boolean Due[DIO_CONFIGURED_PORTS];
+
+	DIO_TRACE_ENTER(DIO_PATTERN_TICK_SID);
+	for (uint8 PortIndex = 0; PortIndex < DIO_CONFIGURED_PORTS; ++PortIndex) {
+		Dio_PatternPlayerType *Player = &Dio_PatternPlayers[PortIndex];
+
+		Due[PortIndex] = FALSE;
+		if (FALSE != Player->Active) {
+			if (0U == --Player->Countdown) {
+				DIO_REG_WRITE(Dio_PatternPorts[PortIndex], *Player->Next);
+				Due[PortIndex] = TRUE;
+			} else {
+				/* Do Nothing */
+			}
+		} else {
+			/* Do Nothing */
+		}
+	}
+
+	for (uint8 PortIndex = 0; PortIndex < DIO_CONFIGURED_PORTS; ++PortIndex) {
+		Dio_PatternPlayerType *Player = &Dio_PatternPlayers[PortIndex];
+
+		if (FALSE != Due[PortIndex]) {
+			Player->Countdown = Player->Rate;
+
+			if (0U != --Player->Remaining) {
+				Player->Next++;
+			} else if (DIO_PATTERN_REPEAT == Player->Mode) {
+				Player->Next = Player->Start;
+				Player->Remaining = Player->Length;
+			} else if (0U != Player->QueuedLength) {
+				/* Double buffer: continue with the queued buffer, the queue is free again */
+				Player->Next = Player->Queued;
+				Player->Start = Player->Queued;
+				Player->Length = Player->QueuedLength;
+				Player->Remaining = Player->QueuedLength;
+				Player->QueuedLength = 0U;
+			} else {
+				/* One shot done, or double buffer underrun: idle, the port keeps the value */
+				Player->Active = FALSE;
+			}
+		} else {
+			/* Do Nothing */
+		}
+	}
+	DIO_TRACE_EXIT();
+}
+
+#endif /* DIO_PATTERN_API == STD_ON */
@@ -0,0 +1,144 @@
+/*===============================================================================
+ * Module: DIO																	*
+ * File Name: Dio_Pattern.h														*
+ * Description: Header file of the flash pattern player of the AVR ATmega32		*
+ *              Microcontroller - DIO Driver									*
+ * Author: Mahmoud-Helmy														*
+ *==============================================================================*/
+/* =============================================================================
+ * 							   FILE GUARD
+ * =============================================================================*/
+#ifndef DIO_PATTERN_H
+#define DIO_PATTERN_H
+/* =============================================================================
+ * 								INCLUDES
+ * =============================================================================*/
+/* Dio types, DET codes and DIO_PATTERN_API */
+#include "Dio.h"
+
+#if (DIO_PATTERN_API == STD_ON)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* =============================================================================
+ * 								   DEFINITIONS
+ * =============================================================================*/
+/* Mode of a pattern player */
+typedef uint8 Dio_PatternModeType;
+
+/* Stop after the last value of the buffer, the port keeps it */
+#define DIO_PATTERN_ONE_SHOT           (Dio_PatternModeType)0x00
+/* Restart from the first value of the buffer, until Dio_StopPattern */
+#define DIO_PATTERN_REPEAT             (Dio_PatternModeType)0x01
+/* Continue with the buffer given to Dio_QueuePattern, stop if none is queued */
+#define DIO_PATTERN_DOUBLE_BUFFER      (Dio_PatternModeType)0x02
+
+/* State of a pattern player */
+typedef uint8 Dio_PatternStatusType;
+
+/* Nothing is played on the port */
+#define DIO_PATTERN_IDLE               (Dio_PatternStatusType)0x00
+/* A buffer is played (and, in double buffer mode, another one is queued) */
+#define DIO_PATTERN_PLAYING            (Dio_PatternStatusType)0x01
+/* Double buffer mode: a buffer is played and the next one can be queued */
+#define DIO_PATTERN_QUEUE_FREE         (Dio_PatternStatusType)0x02
+
+/* =============================================================================
+ * 							 FUNCTION PROTOTYPES
+ * =============================================================================*/
+/* =============================================================================
+ * Service Name: Dio_PlayPattern
+ * Service ID[hex]: 0x1A
+ * Sync/Async: Asynchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Port_Id - ID of DIO port.
+ *                  Buffer - Port values in flash, read in place (never copied to RAM).
+ *                  Length - Number of values of Buffer (1 .. 65535).
+ *                  Rate - Dio_PatternTick calls per value (1 .. 255).
+ *                  Mode - DIO_PATTERN_ONE_SHOT / DIO_PATTERN_REPEAT / DIO_PATTERN_DOUBLE_BUFFER.
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: Std_ReturnType E_OK / E_NOT_OK (invalid parameter)
+ * Description: Function to start streaming Buffer to the PORT register of the port, one
+ *              value every Rate ticks, the first one at the next Dio_PatternTick. A pattern
+ *              already played on the port is replaced. Every value is written as a whole
+ *              port image, so all the pins of the port shall be outputs owned by the player.
+ * =============================================================================*/
+/* Function for DIO Play Pattern API */
+Std_ReturnType Dio_PlayPattern(Dio_PortType Port_Id, const FLASH uint8 *Buffer, uint16 Length,
+		uint8 Rate, Dio_PatternModeType Mode);
+
+/* =============================================================================
+ * Service Name: Dio_QueuePattern
+ * Service ID[hex]: 0x1B
+ * Sync/Async: Asynchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Port_Id - ID of DIO port.
+ *                  Buffer - Next port values in flash.
+ *                  Length - Number of values of Buffer (1 .. 65535).
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: Std_ReturnType E_OK: played right after the current buffer, at the same rate
+ *                              E_NOT_OK: not in double buffer mode, or a buffer is already queued
+ * Description: Function to queue the next buffer of a double buffer pattern. The player
+ *              switches to it without a gap; it is free again (DIO_PATTERN_QUEUE_FREE)
+ *              as soon as the switch is done.
+ * =============================================================================*/
+/* Function for DIO Queue Pattern API */
+Std_ReturnType Dio_QueuePattern(Dio_PortType Port_Id, const FLASH uint8 *Buffer, uint16 Length);
+
+/* =============================================================================
+ * Service Name: Dio_StopPattern
+ * Service ID[hex]: 0x1C
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Port_Id - ID of DIO port.
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to stop the pattern of a port, the port keeps its last value.
+ * =============================================================================*/
+/* Function for DIO Stop Pattern API */
+void Dio_StopPattern(Dio_PortType Port_Id);
+
+/* =============================================================================
+ * Service Name: Dio_GetPatternStatus
+ * Service ID[hex]: 0x1D
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Port_Id - ID of DIO port.
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: Dio_PatternStatusType DIO_PATTERN_IDLE / DIO_PATTERN_PLAYING / DIO_PATTERN_QUEUE_FREE
+ * Description: Function to return the state of the pattern player of a port.
+ * =============================================================================*/
+/* Function for DIO Get Pattern Status API */
+Dio_PatternStatusType Dio_GetPatternStatus(Dio_PortType Port_Id);
+
+/* =============================================================================
+ * Service Name: Dio_PatternTick
+ * Service ID[hex]: 0x1E
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): None
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to be called from a periodic timer ISR (the base rate of all the
+ *              players). The due values of all the ports are written before any bookkeeping,
+ *              so their timing only depends on the ISR latency and on the position of the
+ *              port: each player before it adds its countdown and write (a few cycles).
+ *              No development error checks.
+ * =============================================================================*/
+/* Function for DIO Pattern Tick API */
+void Dio_PatternTick(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DIO_PATTERN_API == STD_ON */
+
+#endif /* DIO_PATTERN_H */
@@ -0,0 +1,274 @@
+/*===============================================================================
+ * Module: DIO																	*
+ * File Name: Dio_Pwm.c															*
+ * Description: Software PWM (bit-angle modulation) of the AVR ATmega32			*
+ *              Microcontroller - DIO Driver									*
+ * Author: Mahmoud-Helmy														*
+ *==============================================================================*/
+/* =============================================================================
+ * 								 INCLUDES
+ * =============================================================================*/
+#include "Dio_Pwm.h"
+#include "MemMap.h"
+#include "SchM_Dio.h"
+#include "Dio_Trace.h"
+
+#if (DIO_PWM_API == STD_ON)
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+#include "../Det/Det.h"
+#endif
+
+/* =============================================================================
+ * 							 GLOBAL VARIABLES
+ * =============================================================================*/
+/* @struct Dio_PwmType: State of the PWM engine.
+ * @member Planes: Two buffers of port images, one per duty bit; Planes[f][b][p] holds duty
+ *                 bit b of the PWM channels of port p (0 for the other pins).
+ * @member Keep: Per port mask of the pins not driven by the PWM.
+ * @member Plane: Next plane written by Dio_PwmTick, NULL_PTR before Dio_PwmInit.
+ * @member Weight: Weight in base ticks of the next plane.
+ * @member Front: Buffer read by Dio_PwmTick, the other one is written by Dio_PwmSetDuty.
+ * @member Pending: Set by Dio_PwmUpdate, cleared by Dio_PwmTick when it swaps the buffers.
+ * @member Synced: FALSE when the back buffer still holds the duties before the last swap.
+ */
+typedef struct Dio_PwmType {
+	uint8 Planes[2][DIO_PWM_RESOLUTION_BITS][DIO_IMAGE_PORTS];
+	uint8 Keep[DIO_IMAGE_PORTS];
+	const uint8 *Plane;
+	uint8 Weight;
+	volatile uint8 Front;
+	volatile uint8 Pending;
+	boolean Synced;
+} Dio_PwmType;
+
+STATIC Dio_PwmType Dio_Pwm;
+
+/* Channels driven by the PWM (bit n = channel n) */
+STATIC Dio_ChannelsLevelType Dio_PwmChannels = 0U;
+
+/* Weight of the last plane of a period */
+#define DIO_PWM_LAST_WEIGHT            ((uint8)(1U << (DIO_PWM_RESOLUTION_BITS - 1U)))
+
+/* Copies the PWM pins of a plane to a port, skipped when the port has no PWM channel */
+#define DIO_PWM_WRITE_PORT(PORT_REG, PORT_INDEX, PLANE) \
+	do { \
+		uint8 Keep = Dio_Pwm.Keep[(PORT_INDEX)]; \
+		if (Keep != 0xFFU) { \
+			DIO_REG_WRITE(&(PORT_REG), (uint8)((DIO_REG_READ(&(PORT_REG)) & Keep) | (PLANE)[(PORT_INDEX)])); \
+		} else { \
+			/* Do Nothing */ \
+		} \
+	} while (0)
+
+/* =============================================================================
+ * 								  APIs
+ * =============================================================================*/
+/* =============================================================================
+ * Service Name: Dio_PwmInit
+ * Service ID[hex]: 0x16
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): Channels - Channels driven by the PWM (bit n = channel n).
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to initialize the PWM engine with all the duties at 0.
+ * =============================================================================*/
+void Dio_PwmInit(Dio_ChannelsLevelType Channels) {
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* At least one channel shall be driven */
+	if (0U == Channels) {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_PWM_INIT_SID, DIO_E_PARAM_CONFIG);
+		error = TRUE;
+	} else {
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if (FALSE == error) {
+		/* Stop the tick while the planes are rebuilt (the pointer store is not atomic) */
+		SchM_Enter_Dio_PortAccess();
+		Dio_Pwm.Plane = NULL_PTR;
+		SchM_Exit_Dio_PortAccess();
+
+		for (uint8 Bit = 0; Bit < DIO_PWM_RESOLUTION_BITS; ++Bit) {
+			for (uint8 PortIndex = 0; PortIndex < DIO_IMAGE_PORTS; ++PortIndex) {
+				Dio_Pwm.Planes[0][Bit][PortIndex] = 0U;
+				Dio_Pwm.Planes[1][Bit][PortIndex] = 0U;
+			}
+		}
+		for (uint8 PortIndex = 0; PortIndex < DIO_IMAGE_PORTS; ++PortIndex) {
+			Dio_Pwm.Keep[PortIndex] = (uint8)(~(uint8)(Channels >> (PortIndex * NUM_OF_PINS_IN_SINGLE_PORT)));
+		}
+		Dio_PwmChannels = Channels;
+		Dio_Pwm.Front = 0U;
+		Dio_Pwm.Pending = 0U;
+		Dio_Pwm.Synced = TRUE;
+		Dio_Pwm.Weight = 1U;
+
+		SchM_Enter_Dio_PortAccess();
+		Dio_Pwm.Plane = &Dio_Pwm.Planes[0][0][0];
+		SchM_Exit_Dio_PortAccess();
+	}
+}
+
+/* =============================================================================
+ * Service Name: Dio_PwmSetDuty
+ * Service ID[hex]: 0x17
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): Channel_Id - Global ID of the channel (PIN_A_0 .. PIN_D_7).
+ *                  Duty - 0 .. DIO_PWM_MAX_DUTY, higher values are saturated.
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: Std_ReturnType E_OK / E_NOT_OK
+ * Description: Function to set the duty of a channel in the back buffer.
+ * =============================================================================*/
+Std_ReturnType Dio_PwmSetDuty(Dio_ChannelType Channel_Id, Dio_PwmDutyType Duty) {
+	Std_ReturnType output = E_NOT_OK;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the PWM is initialized before using this function */
+	if (NULL_PTR == Dio_Pwm.Plane) {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_PWM_SET_DUTY_SID, DIO_E_UNINIT);
+		error = TRUE;
+	} else {
+		/* No Action Required */
+	}
+#endif
+	/* Check if the channel is driven by the PWM (also protects the plane index) */
+	if ((DIO_IMAGE_CHANNELS <= Channel_Id) || (0U == ((Dio_PwmChannels >> Channel_Id) & 1U))) {
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_PWM_SET_DUTY_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+#endif
+		error = TRUE;
+	} else {
+		/* No Action Required */
+	}
+
+	/* The back buffer is owned by Dio_PwmTick until the published update is applied */
+	if ((FALSE == error) && (0U == Dio_Pwm.Pending)) {
+		/* Front cannot change while nothing is pending */
+		uint8 Back = (uint8)(Dio_Pwm.Front ^ 1U);
+		uint8 PortIndex = (uint8)(Channel_Id / NUM_OF_PINS_IN_SINGLE_PORT);
+		uint8 Mask = DIO_CHANNEL_BIT(Channel_Id);
+
+		/* First change after a swap: start from the duties shown now */
+		if (FALSE == Dio_Pwm.Synced) {
+			for (uint8 Bit = 0; Bit < DIO_PWM_RESOLUTION_BITS; ++Bit) {
+				for (uint8 Index = 0; Index < DIO_IMAGE_PORTS; ++Index) {
+					Dio_Pwm.Planes[Back][Bit][Index] = Dio_Pwm.Planes[Back ^ 1U][Bit][Index];
+				}
+			}
+			Dio_Pwm.Synced = TRUE;
+		} else {
+			/* Do Nothing */
+		}
+
+#if (DIO_PWM_RESOLUTION_BITS < 8U)
+		if (Duty > DIO_PWM_MAX_DUTY) {
+			Duty = DIO_PWM_MAX_DUTY;
+		} else {
+			/* Do Nothing */
+		}
+#endif
+
+		/* Duty bit b goes to plane b */
+		for (uint8 Bit = 0; Bit < DIO_PWM_RESOLUTION_BITS; ++Bit) {
+			if ((Duty & 1U) != 0U) {
+				Dio_Pwm.Planes[Back][Bit][PortIndex] |= Mask;
+			} else {
+				Dio_Pwm.Planes[Back][Bit][PortIndex] &= (uint8)(~Mask);
+			}
+			Duty >>= 1;
+		}
+		output = E_OK;
+	} else {
+		/* Do Nothing */
+	}
+	return output;
+}
+
+/* =============================================================================
+ * Service Name: Dio_PwmUpdate
+ * Service ID[hex]: 0x18
+ * Sync/Async: Asynchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): None
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to publish the back buffer at the start of the next period.
+ * =============================================================================*/
+void Dio_PwmUpdate(void) {
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the PWM is initialized before using this function */
+	if (NULL_PTR == Dio_Pwm.Plane) {
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_PWM_UPDATE_SID, DIO_E_UNINIT);
+		error = TRUE;
+	} else {
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if (FALSE == error) {
+		/* After the swap the new back buffer holds the previous duties */
+		Dio_Pwm.Synced = FALSE;
+		Dio_Pwm.Pending = 1U;
+	}
+}
+
+/* =============================================================================
+ * Service Name: Dio_PwmTick
+ * Service ID[hex]: 0x19
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): None
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: uint8 Weight of the plane just written, in base ticks
+ * Description: Function to write the next bit plane to PORTA .. PORTD, called from a
+ *              timer compare ISR. Same path for any number of PWM channels.
+ * =============================================================================*/
+uint8 Dio_PwmTick(void) {
+	DIO_TRACE_ENTER(DIO_PWM_TICK_SID);
+	const uint8 *Plane = Dio_Pwm.Plane;
+	uint8 Weight = Dio_Pwm.Weight;
+
+	if (NULL_PTR != Plane) {
+		/* One read-modify-write per port with PWM channels, unrolled so every port has a
+		 * constant address; the other ports are not accessed at all */
+		DIO_PWM_WRITE_PORT(PORTA, 0U, Plane);
+		DIO_PWM_WRITE_PORT(PORTB, 1U, Plane);
+		DIO_PWM_WRITE_PORT(PORTC, 2U, Plane);
+		DIO_PWM_WRITE_PORT(PORTD, 3U, Plane);
+
+		if (DIO_PWM_LAST_WEIGHT == Weight) {
+			/* Period wrap: apply a published update, then restart from plane 0 */
+			uint8 Front = (uint8)(Dio_Pwm.Front ^ Dio_Pwm.Pending);
+
+			Dio_Pwm.Front = Front;
+			Dio_Pwm.Pending = 0U;
+			Dio_Pwm.Plane = &Dio_Pwm.Planes[Front][0][0];
+			Dio_Pwm.Weight = 1U;
+		} else {
+			Dio_Pwm.Plane = &Plane[DIO_IMAGE_PORTS];
+			Dio_Pwm.Weight = (uint8)(Weight << 1);
+		}
+	} else {
+		/* Not initialized: shortest interval, the ports are not touched */
+		Weight = 1U;
+	}
+	DIO_TRACE_EXIT();
+	return Weight;
+}
+
+#endif /* DIO_PWM_API == STD_ON */
@@ -0,0 +1,140 @@
+/*===============================================================================
+ * Module: DIO																	*
+ * File Name: Dio_Pwm.h															*
+ * Description: Header file of the software PWM (bit-angle modulation) of the	*
+ *              AVR ATmega32 Microcontroller - DIO Driver						*
+ * Author: Mahmoud-Helmy														*
+ *==============================================================================*/
+/* =============================================================================
+ * 							   FILE GUARD
+ * =============================================================================*/
+#ifndef DIO_PWM_H
+#define DIO_PWM_H
+/* =============================================================================
+ * 								INCLUDES
+ * =============================================================================*/
+/* Dio types, DET codes and DIO_PWM_API / DIO_PWM_RESOLUTION_BITS */
+#include "Dio.h"
+
+#if (DIO_PWM_API == STD_ON)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* =============================================================================
+ * 								   DEFINITIONS
+ * =============================================================================*/
+/* Range check of the PWM configuration */
+#if ((DIO_PWM_RESOLUTION_BITS < 1U) || (DIO_PWM_RESOLUTION_BITS > 8U))
+  #error "DIO_PWM_RESOLUTION_BITS shall be within 1 .. 8"
+#endif
+
+/* Highest duty value (always on), the PWM period is DIO_PWM_MAX_DUTY base ticks */
+#define DIO_PWM_MAX_DUTY               ((uint8)((1U << DIO_PWM_RESOLUTION_BITS) - 1U))
+
+/*
+ * Bit-angle modulation: duty bit b of every PWM channel is shown for 2^b base ticks.
+ * Dio_PwmSetDuty spreads the duty of a channel over DIO_PWM_RESOLUTION_BITS precomputed
+ * port images (bit planes), so one tick only copies one plane to the ports of PORTA .. PORTD
+ * that have PWM channels (Keep != 0xFF), whatever the number of channels of each port:
+ *
+ *     ld   r30, Plane    ; plane pointer
+ *     ld   r25, Keep+x   ; \
+ *     cpi  r25, 0xFF     ;  |  per port: skip a port without PWM channels,
+ *     breq next          ;  |  otherwise keep its non PWM pins and copy
+ *     in   r24, PORTx    ;  |  the PWM pins of the plane
+ *     and  r24, r25      ;  |
+ *     ld   r25, Z+x      ;  |
+ *     or   r24, r25      ;  |
+ *     out  PORTx, r24    ; /
+ *     ...                ; next plane pointer and weight, or the buffer swap at the period wrap
+ *
+ * These figures are estimated from the listing above, not measured (no simavr run is
+ * recorded). Assumptions: no DIO_TRACE (each port write is then a call of Dio_TraceWrite),
+ * and the cost of the caller's ISR is not included. A C ISR calling the out-of-line
+ * Dio_PwmTick saves and restores all the call-clobbered registers, an estimated 60 cycles on
+ * top of the function body. Dio_Bench reports the cost of the call alone as Dio_PwmTick.
+ */
+
+/* Duty of a PWM channel, 0 (always off) .. DIO_PWM_MAX_DUTY (always on) */
+typedef uint8 Dio_PwmDutyType;
+
+/* =============================================================================
+ * 							 FUNCTION PROTOTYPES
+ * =============================================================================*/
+/* =============================================================================
+ * Service Name: Dio_PwmInit
+ * Service ID[hex]: 0x16
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): Channels - Channels driven by the PWM (bit n = channel n).
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to initialize the PWM engine with all the duties at 0. The
+ *              channels shall be configured as outputs. Their PORT bits belong to the
+ *              PWM from now on: Dio_PwmTick overwrites them, the other pins of the port
+ *              are kept (DIO_DEFERRED_WRITE cannot be enabled with the PWM, see Dio.h).
+ * =============================================================================*/
+/* Function for DIO PWM Initialization API */
+void Dio_PwmInit(Dio_ChannelsLevelType Channels);
+
+/* =============================================================================
+ * Service Name: Dio_PwmSetDuty
+ * Service ID[hex]: 0x17
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): Channel_Id - Global ID of the channel (PIN_A_0 .. PIN_D_7).
+ *                  Duty - 0 .. DIO_PWM_MAX_DUTY, higher values are saturated.
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: Std_ReturnType E_OK: duty stored in the back buffer
+ *                              E_NOT_OK: invalid channel, or the previous
+ *                              Dio_PwmUpdate is not applied yet (retry later)
+ * Description: Function to set the duty of a channel in the back buffer. The new
+ *              duties are applied together by Dio_PwmUpdate.
+ * =============================================================================*/
+/* Function for DIO PWM set Duty API */
+Std_ReturnType Dio_PwmSetDuty(Dio_ChannelType Channel_Id, Dio_PwmDutyType Duty);
+
+/* =============================================================================
+ * Service Name: Dio_PwmUpdate
+ * Service ID[hex]: 0x18
+ * Sync/Async: Asynchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): None
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to publish the back buffer. Dio_PwmTick swaps the buffers at the
+ *              start of the next PWM period, so no period mixes old and new duties.
+ * =============================================================================*/
+/* Function for DIO PWM Update API */
+void Dio_PwmUpdate(void);
+
+/* =============================================================================
+ * Service Name: Dio_PwmTick
+ * Service ID[hex]: 0x19
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): None
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: uint8 Weight of the plane just written, in base ticks (1, 2, 4 .. 128)
+ * Description: Function to be called from a timer compare ISR. It writes the next bit
+ *              plane to PORTA .. PORTD and returns how long it shall stay, the ISR
+ *              reloads the compare register with it (e.g. OCR0 = (Weight * K) - 1 in CTC
+ *              mode), so there is one interrupt per bit plane.
+ *              Does nothing before Dio_PwmInit. No development error checks.
+ * =============================================================================*/
+/* Function for DIO PWM Tick API */
+uint8 Dio_PwmTick(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DIO_PWM_API == STD_ON */
+
+#endif /* DIO_PWM_H */
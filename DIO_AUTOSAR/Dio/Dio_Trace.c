@@ -0,0 +1,130 @@
+/*===============================================================================
+ * Module: DIO																	*
+ * File Name: Dio_Trace.c														*
+ * Description: Register write trace of the AVR ATmega32 Microcontroller -		*
+ *              DIO Driver														*
+ * Author: Mahmoud-Helmy														*
+ *==============================================================================*/
+/* =============================================================================
+ * 								 INCLUDES
+ * =============================================================================*/
+#include "Dio_Trace.h"
+#include "MemMap.h"
+#include "SchM_Dio.h"
+
+#if (DIO_TRACE == STD_ON)
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+#include "../Det/Det.h"
+#endif
+
+/* =============================================================================
+ * 							 GLOBAL VARIABLES
+ * =============================================================================*/
+/* Ring of the last register writes, slot (Dio_TraceHead % DIO_TRACE_RECORDS) is the next
+ * one written. Not static, so a debugger can dump it by name */
+Dio_TraceRecordType Dio_TraceBuffer[DIO_TRACE_RECORDS];
+
+/* Free running index of the next record */
+STATIC volatile uint8 Dio_TraceHead = 0U;
+
+/* Number of valid records (saturates at DIO_TRACE_RECORDS) */
+STATIC volatile uint8 Dio_TraceFill = 0U;
+
+volatile uint8 Dio_TraceService = DIO_TRACE_NO_SERVICE;
+
+/* Ring slot of a free running record index */
+#define DIO_TRACE_SLOT(INDEX)          ((uint8)((INDEX) & (DIO_TRACE_RECORDS - 1U)))
+
+/* =============================================================================
+ * 								  APIs
+ * =============================================================================*/
+/* =============================================================================
+ * Service Name: Dio_TraceWrite
+ * Service ID[hex]: None
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Reg - Register to be written.
+ *                  Value - Value to be written.
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: DIO_REG_WRITE of the trace mode (MemMap.h): records the write, then
+ *              does it. The record and the write are one exclusive area, so the
+ *              records of nested ISR writes stay in the order of the writes.
+ * =============================================================================*/
+void Dio_TraceWrite(volatile uint8 *Reg, uint8 Value) {
+	Dio_TraceRecordType *Record;
+
+	SchM_Enter_Dio_PortAccess();
+	Record = &Dio_TraceBuffer[DIO_TRACE_SLOT(Dio_TraceHead)];
+	Record->Time = Dio_ClockRead();
+	Record->Address = (uint8)DIO_REG_ADDRESS(Reg);
+	Record->Service = Dio_TraceService;
+	Record->Old = DIO_REG_READ(Reg);
+	Record->New = Value;
+	DIO_REG_WRITE_RAW(Reg, Value);
+	Dio_TraceHead++;
+	if (Dio_TraceFill < DIO_TRACE_RECORDS) {
+		Dio_TraceFill++;
+	} else {
+		/* Full: the oldest record was overwritten */
+	}
+	SchM_Exit_Dio_PortAccess();
+}
+
+/* =============================================================================
+ * Service Name: Dio_GetTrace
+ * Service ID[hex]: 0x21
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): MaxRecords - Size of Records.
+ * Parameters (input): None
+ * Parameters (out): Records - Last register writes, oldest first.
+ * Return value: uint8 Number of records copied
+ * Description: Function to copy the trace, oldest record first.
+ * =============================================================================*/
+uint8 Dio_GetTrace(Dio_TraceRecordType *Records, uint8 MaxRecords) {
+	uint8 Count = 0U;
+
+	/* Check if input pointer is not Null pointer */
+	if (NULL_PTR == Records) {
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_GET_TRACE_SID, DIO_E_PARAM_POINTER);
+#endif
+	} else {
+		uint8 First;
+
+		SchM_Enter_Dio_PortAccess();
+		Count = (Dio_TraceFill < MaxRecords) ? Dio_TraceFill : MaxRecords;
+		First = (uint8)(Dio_TraceHead - Count);
+		SchM_Exit_Dio_PortAccess();
+
+		/* One record per exclusive area, the interrupt lock stays short */
+		for (uint8 Index = 0U; Index < Count; ++Index) {
+			SchM_Enter_Dio_PortAccess();
+			Records[Index] = Dio_TraceBuffer[DIO_TRACE_SLOT(First + Index)];
+			SchM_Exit_Dio_PortAccess();
+		}
+	}
+	return Count;
+}
+
+/* =============================================================================
+ * Service Name: Dio_ClearTrace
+ * Service ID[hex]: 0x22
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): None
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to drop all the records of the trace.
+ * =============================================================================*/
+void Dio_ClearTrace(void) {
+	SchM_Enter_Dio_PortAccess();
+	Dio_TraceFill = 0U;
+	SchM_Exit_Dio_PortAccess();
+}
+
+#endif /* DIO_TRACE == STD_ON */
@@ -0,0 +1,105 @@
+/*===============================================================================
+ * Module: DIO																	*
+ * File Name: Dio_Trace.h														*
+ * Description: Header file of the register write trace of the AVR ATmega32		*
+ *              Microcontroller - DIO Driver									*
+ * Author: Mahmoud-Helmy														*
+ *==============================================================================*/
+/* =============================================================================
+ * 							   FILE GUARD
+ * =============================================================================*/
+#ifndef DIO_TRACE_H
+#define DIO_TRACE_H
+/* =============================================================================
+ * 								INCLUDES
+ * =============================================================================*/
+/* Dio types, DET codes and DIO_TRACE / DIO_TRACE_RECORDS */
+#include "Dio.h"
+
+#if (DIO_TRACE == STD_ON)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* =============================================================================
+ * 								   DEFINITIONS
+ * =============================================================================*/
+/* Range check of the trace configuration */
+#if ((DIO_TRACE_RECORDS < 2U) || (DIO_TRACE_RECORDS > 128U) || ((DIO_TRACE_RECORDS & (DIO_TRACE_RECORDS - 1U)) != 0U))
+  #error "DIO_TRACE_RECORDS shall be a power of 2 within 2 .. 128"
+#endif
+
+/* Service ID of the writes done outside of any DIO service */
+#define DIO_TRACE_NO_SERVICE           (uint8)0xFF
+
+/*
+ * One register write, 6 bytes, little endian as stored by the ATmega32 (and by the host
+ * build): Host/DioTrace.py decodes a dump of these records into a timeline.
+ */
+typedef struct Dio_TraceRecordType {
+	/* Dio_ClockRead() before the write: Timer1 count on the target, ns on the host */
+	uint16 Time;
+	/* Low byte of the data space address of the register (see MemMap.h), unique among the
+	 * registers the driver writes: the extended I/O ports of the ATmega2560 (0x100 .. 0x10B)
+	 * only share it with CPU registers */
+	uint8 Address;
+	/* DIO_*_SID of the service doing the write, DIO_TRACE_NO_SERVICE outside of a service */
+	uint8 Service;
+	/* Register value before and after the write */
+	uint8 Old;
+	uint8 New;
+} Dio_TraceRecordType;
+
+/* Service ID of the current write, kept by DIO_TRACE_ENTER / DIO_TRACE_EXIT */
+extern volatile uint8 Dio_TraceService;
+
+/* Entry / exit of a service: an ISR service nested in another one restores its caller's ID */
+#define DIO_TRACE_ENTER(SID)           uint8 Dio_TraceCaller = Dio_TraceService; Dio_TraceService = (SID);
+#define DIO_TRACE_EXIT()               Dio_TraceService = Dio_TraceCaller;
+
+/* =============================================================================
+ * 							 FUNCTION PROTOTYPES
+ * =============================================================================*/
+/* =============================================================================
+ * Service Name: Dio_GetTrace
+ * Service ID[hex]: 0x21
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): MaxRecords - Size of Records.
+ * Parameters (input): None
+ * Parameters (out): Records - Last register writes, oldest first.
+ * Return value: uint8 Number of records copied (at most DIO_TRACE_RECORDS)
+ * Description: Function to copy the trace, e.g. from a fault handler before it is sent
+ *              to the host. Records written while copying may be missing from the copy.
+ * =============================================================================*/
+/* Function for DIO get Trace API */
+uint8 Dio_GetTrace(Dio_TraceRecordType *Records, uint8 MaxRecords);
+
+/* =============================================================================
+ * Service Name: Dio_ClearTrace
+ * Service ID[hex]: 0x22
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): None
+ * Parameters (input): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Function to drop all the records of the trace.
+ * =============================================================================*/
+/* Function for DIO clear Trace API */
+void Dio_ClearTrace(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#else
+
+/* Trace disabled: no code, no data */
+#define DIO_TRACE_ENTER(SID)
+#define DIO_TRACE_EXIT()
+
+#endif /* DIO_TRACE == STD_ON */
+
+#endif /* DIO_TRACE_H */
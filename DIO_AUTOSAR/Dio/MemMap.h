@@ -1,7 +1,7 @@
 /*======================================================================================================
  * Module: DIO																							*															*
  * File Name: MemMap.h																				    *																*
- * Description: Memory Mapping Registers for AVR ATmega32 Microcontroller - DIO Driver          		*
+ * Description: Memory Mapping Registers for AVR ATmega32/128/2560 - DIO Driver                 		*
  * Author: Mahmoud-Helmy																				*
  *======================================================================================================*/
 /* =====================================================================================================
@@ -29,6 +29,9 @@
 
 #include "../LIB/Std_Types.h"
 
+/* DIO_TRACE, DIO_DEVICE */
+#include "Dio_Cfg.h"
+
 /* =====================================================================================================
  * 										VERSION CHECK
  * =====================================================================================================*/
@@ -56,19 +59,192 @@ typedef union PORT_Union
 	} BitField;
 }PORT_Union;
 
-#define PORTA          *((volatile uint8 *)(0X3B))
-#define PORTB          *((volatile uint8 *)(0X38))
-#define PORTC          *((volatile uint8 *)(0X35))
-#define PORTD          *((volatile uint8 *)(0X32))
+/* =====================================================================================================
+ * 										REGISTER ACCESS BACKEND
+ * =====================================================================================================*/
+#if defined(DIO_HOST_BACKEND)
+/* Host build: the registers live in a simulated register file and every access goes through
+ * the host backend (Host/Dio_Host.c), so the unchanged driver runs on the build machine. */
+#include "../Host/Dio_Host.h"
+
+#define DIO_REGISTER(ADDRESS)          (Dio_HostRegisterFile[(ADDRESS)])
+#define DIO_REG_READ(REG_PTR)          Dio_HostRead(REG_PTR)
+#define DIO_REG_WRITE_RAW(REG_PTR, VALUE)  Dio_HostWrite((REG_PTR), (VALUE))
+#define DIO_REG_ADDRESS(REG_PTR)       ((uint16)((REG_PTR) - Dio_HostRegisterFile))
+#else
+/* Target build: memory mapped I/O registers of the device */
+#define DIO_REGISTER(ADDRESS)          (*((volatile uint8 *)(ADDRESS)))
+#define DIO_REG_READ(REG_PTR)          (*(REG_PTR))
+#define DIO_REG_WRITE_RAW(REG_PTR, VALUE)  (*(REG_PTR) = (VALUE))
+#define DIO_REG_ADDRESS(REG_PTR)       ((uint16)(__SIZE_TYPE__)(REG_PTR))
+#endif
+
+#if (DIO_TRACE == STD_ON)
+/* Trace mode: every register write of the driver is recorded first (Dio_Trace.c) */
+#ifdef __cplusplus
+extern "C"
+#endif
+void Dio_TraceWrite(volatile uint8 *Reg, uint8 Value);
+#define DIO_REG_WRITE(REG_PTR, VALUE)  Dio_TraceWrite((REG_PTR), (VALUE))
+#else
+#define DIO_REG_WRITE(REG_PTR, VALUE)  DIO_REG_WRITE_RAW((REG_PTR), (VALUE))
+#endif
+
+/* =====================================================================================================
+ * 										    DEVICE REGISTERS
+ * =====================================================================================================*/
+/* Status register, saved / restored around the atomic read-modify-writes (SchM_Dio.h),
+ * at the same address on all the supported devices */
+#define SREG           DIO_REGISTER(0X5F)
+
+/* Register map of the device selected by DIO_DEVICE (Dio_Cfg.h).
+ * DIO_DEVICE_PORTS(ENTRY, ARG) expands ENTRY(ARG, <port letter>) once per port in Port_Id order
+ * (PORTA_ID first), the driver builds its port and channel tables from it by token pasting
+ * (PORT##L, PIN##L, DDR##L, PORT##L##_ID), so a new device is one more block here and one
+ * more entry of DEVICES in Generator/DioGen.py.
+ * DIO_DEVICE_BONDED_PINS lists the pins bonded out on each port in the same order (bit n = PINn),
+ * the development error checks of the channel APIs reject the other pins.
+ * Ports whose registers are above the bit addressable range are reached with lds/sts only,
+ * see DIO_REG_IS_BIT_ADDRESSABLE below. */
+#if (DIO_DEVICE == DIO_DEVICE_ATMEGA32)
+#define DIO_DEVICE_NAME                "atmega32"
+#define DIO_DEVICE_PORT_COUNT          (4U)
+#define DIO_DEVICE_PORTS(ENTRY, ARG)   ENTRY(ARG, A) ENTRY(ARG, B) ENTRY(ARG, C) ENTRY(ARG, D)
+#define DIO_DEVICE_BONDED_PINS         { 0xFFU, 0xFFU, 0xFFU, 0xFFU }
+
+#define PORTA          DIO_REGISTER(0X3B)
+#define PORTB          DIO_REGISTER(0X38)
+#define PORTC          DIO_REGISTER(0X35)
+#define PORTD          DIO_REGISTER(0X32)
+
+#define PINA           DIO_REGISTER(0X39)
+#define PINB           DIO_REGISTER(0X36)
+#define PINC           DIO_REGISTER(0X33)
+#define PIND           DIO_REGISTER(0X30)
+
+#define DDRA           DIO_REGISTER(0X3A)
+#define DDRB           DIO_REGISTER(0X37)
+#define DDRC           DIO_REGISTER(0X34)
+#define DDRD           DIO_REGISTER(0X31)
+
+/* Timer1 counter, time base of the service statistics (DIO_PROFILING).
+ * Read TCNT1L first, it latches TCNT1H */
+#define TCNT1L         DIO_REGISTER(0X4C)
+#define TCNT1H         DIO_REGISTER(0X4D)
+
+#elif (DIO_DEVICE == DIO_DEVICE_ATMEGA128)
+/* PORTA .. PORTE in the bit addressable range, DDRF / PORTF and PORTG in the extended I/O space
+ * (PINF stays at 0x20), PORTG has 5 pins */
+#define DIO_DEVICE_NAME                "atmega128"
+#define DIO_DEVICE_PORT_COUNT          (7U)
+#define DIO_DEVICE_PORTS(ENTRY, ARG)   ENTRY(ARG, A) ENTRY(ARG, B) ENTRY(ARG, C) ENTRY(ARG, D) \
+                                       ENTRY(ARG, E) ENTRY(ARG, F) ENTRY(ARG, G)
+#define DIO_DEVICE_BONDED_PINS         { 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0x1FU }
+
+#define PORTA          DIO_REGISTER(0X3B)
+#define PORTB          DIO_REGISTER(0X38)
+#define PORTC          DIO_REGISTER(0X35)
+#define PORTD          DIO_REGISTER(0X32)
+#define PORTE          DIO_REGISTER(0X23)
+#define PORTF          DIO_REGISTER(0X62)
+#define PORTG          DIO_REGISTER(0X65)
+
+#define PINA           DIO_REGISTER(0X39)
+#define PINB           DIO_REGISTER(0X36)
+#define PINC           DIO_REGISTER(0X33)
+#define PIND           DIO_REGISTER(0X30)
+#define PINE           DIO_REGISTER(0X21)
+#define PINF           DIO_REGISTER(0X20)
+#define PING           DIO_REGISTER(0X63)
+
+#define DDRA           DIO_REGISTER(0X3A)
+#define DDRB           DIO_REGISTER(0X37)
+#define DDRC           DIO_REGISTER(0X34)
+#define DDRD           DIO_REGISTER(0X31)
+#define DDRE           DIO_REGISTER(0X22)
+#define DDRF           DIO_REGISTER(0X61)
+#define DDRG           DIO_REGISTER(0X64)
+
+/* Timer1 counter, time base of the service statistics (DIO_PROFILING).
+ * Read TCNT1L first, it latches TCNT1H */
+#define TCNT1L         DIO_REGISTER(0X4C)
+#define TCNT1H         DIO_REGISTER(0X4D)
+
+#elif (DIO_DEVICE == DIO_DEVICE_ATMEGA2560)
+/* PORTA .. PORTG in the bit addressable range, PORTH .. PORTL in the extended I/O space,
+ * PORTG has 6 pins and there is no PORTI */
+#define DIO_DEVICE_NAME                "atmega2560"
+#define DIO_DEVICE_PORT_COUNT          (11U)
+#define DIO_DEVICE_PORTS(ENTRY, ARG)   ENTRY(ARG, A) ENTRY(ARG, B) ENTRY(ARG, C) ENTRY(ARG, D) \
+                                       ENTRY(ARG, E) ENTRY(ARG, F) ENTRY(ARG, G) ENTRY(ARG, H) \
+                                       ENTRY(ARG, J) ENTRY(ARG, K) ENTRY(ARG, L)
+#define DIO_DEVICE_BONDED_PINS         { 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0x3FU, 0xFFU, \
+                                         0xFFU, 0xFFU, 0xFFU }
+
+#define PORTA          DIO_REGISTER(0X22)
+#define PORTB          DIO_REGISTER(0X25)
+#define PORTC          DIO_REGISTER(0X28)
+#define PORTD          DIO_REGISTER(0X2B)
+#define PORTE          DIO_REGISTER(0X2E)
+#define PORTF          DIO_REGISTER(0X31)
+#define PORTG          DIO_REGISTER(0X34)
+#define PORTH          DIO_REGISTER(0X102)
+#define PORTJ          DIO_REGISTER(0X105)
+#define PORTK          DIO_REGISTER(0X108)
+#define PORTL          DIO_REGISTER(0X10B)
+
+#define PINA           DIO_REGISTER(0X20)
+#define PINB           DIO_REGISTER(0X23)
+#define PINC           DIO_REGISTER(0X26)
+#define PIND           DIO_REGISTER(0X29)
+#define PINE           DIO_REGISTER(0X2C)
+#define PINF           DIO_REGISTER(0X2F)
+#define PING           DIO_REGISTER(0X32)
+#define PINH           DIO_REGISTER(0X100)
+#define PINJ           DIO_REGISTER(0X103)
+#define PINK           DIO_REGISTER(0X106)
+#define PINL           DIO_REGISTER(0X109)
+
+#define DDRA           DIO_REGISTER(0X21)
+#define DDRB           DIO_REGISTER(0X24)
+#define DDRC           DIO_REGISTER(0X27)
+#define DDRD           DIO_REGISTER(0X2A)
+#define DDRE           DIO_REGISTER(0X2D)
+#define DDRF           DIO_REGISTER(0X30)
+#define DDRG           DIO_REGISTER(0X33)
+#define DDRH           DIO_REGISTER(0X101)
+#define DDRJ           DIO_REGISTER(0X104)
+#define DDRK           DIO_REGISTER(0X107)
+#define DDRL           DIO_REGISTER(0X10A)
+
+/* Timer1 counter, time base of the service statistics (DIO_PROFILING).
+ * Read TCNT1L first, it latches TCNT1H */
+#define TCNT1L         DIO_REGISTER(0X84)
+#define TCNT1H         DIO_REGISTER(0X85)
+
+#else
+  #error "DIO_DEVICE shall be DIO_DEVICE_ATMEGA32, DIO_DEVICE_ATMEGA128 or DIO_DEVICE_ATMEGA2560"
+#endif
+
+/* The generated configuration and the register map shall describe the same device */
+#if (DIO_DEVICE_PORT_COUNT != DIO_CONFIGURED_PORTS)
+  #error "DIO_CONFIGURED_PORTS of Dio_Cfg.h does not match the ports of DIO_DEVICE"
+#endif
+
+#if ((defined(__AVR_ATmega32__) && (DIO_DEVICE != DIO_DEVICE_ATMEGA32))\
+ ||  (defined(__AVR_ATmega128__) && (DIO_DEVICE != DIO_DEVICE_ATMEGA128))\
+ ||  (defined(__AVR_ATmega2560__) && (DIO_DEVICE != DIO_DEVICE_ATMEGA2560)))
+  #error "DIO_DEVICE does not match the -mmcu of the target build"
+#endif
 
-#define PINA           *((volatile uint8 *)(0X39))
-#define PINB           *((volatile uint8 *)(0X36))
-#define PINC           *((volatile uint8 *)(0X33))
-#define PIND           *((volatile uint8 *)(0X30))
+/* Address of a register of a port of the table, e.g. DIO_DEVICE_PORTS(DIO_DEVICE_REG_ENTRY, DDR)
+ * gives the initializer list &DDRA, &DDRB, ... */
+#define DIO_DEVICE_REG_ENTRY(REG, L)   &REG##L,
 
-#define DDRA          *((volatile uint8 *)(0X3A))
-#define DDRB          *((volatile uint8 *)(0X37))
-#define DDRC          *((volatile uint8 *)(0X34))
-#define DDRD          *((volatile uint8 *)(0X31))
+/* Access class of a register, folds at compile time for a constant register:
+ * below 0x40 sbi / cbi / sbic / sbis and in / out, below 0x60 in / out only,
+ * above (extended I/O) lds / sts only, so a single bit update needs a locked read-modify-write */
+#define DIO_REG_IS_BIT_ADDRESSABLE(REG_PTR)  (DIO_REG_ADDRESS(REG_PTR) < 0x40U)
+#define DIO_REG_IS_IO_ADDRESSABLE(REG_PTR)   (DIO_REG_ADDRESS(REG_PTR) < 0x60U)
 
 #endif /* DIO_REGS_H */
@@ -0,0 +1,120 @@
+/*======================================================================================================
+ * Module: DIO																							*
+ * File Name: SchM_Dio.h																				*
+ * Description: Exclusive areas (interrupt lock) of the AVR ATmega32 Microcontroller - DIO Driver		*
+ * Author: Mahmoud-Helmy																				*
+ *======================================================================================================*/
+/* =====================================================================================================
+ * 											 FILE GUARD
+ * =====================================================================================================*/
+#ifndef SCHM_DIO_H
+#define SCHM_DIO_H
+
+/* =====================================================================================================
+ * 											INCLUDES
+ * =====================================================================================================*/
+/* DIO_ATOMIC_ACCESS */
+#include "Dio_Cfg.h"
+
+/* SREG, DIO_REG_READ / DIO_REG_WRITE_RAW (SREG is never traced) */
+#include "MemMap.h"
+
+/* =====================================================================================================
+ * 										   DEFINITIONS
+ * =====================================================================================================*/
+/*
+ * Every read-modify-write of a PORTx / DDRx register done by the driver is wrapped in the
+ * Dio_PortAccess exclusive area, so an ISR writing another pin of the same port cannot be lost.
+ * Such an area covers exactly one register update; all the masks are computed before entering it.
+ *
+ * The lock saves SREG, clears the I flag and restores SREG (it never sets I on its own, so the
+ * APIs may be called with interrupts already disabled). Compiled code inside the area:
+ *
+ *     in   r0, SREG      ; save              (outside the window)
+ *     cli                ;                    1 cycle
+ *     ld   r24, Z        ; read register      2 cycles
+ *     and  r24, r25      ; clear bits         1 cycle  (write group / channels32 / port)
+ *     or   r24, r18      ; set bits           1 cycle  (single channel: only one of the two)
+ *     st   Z, r24        ; write register     2 cycles
+ *     out  SREG, r0      ; restore            1 cycle
+ *
+ * DIO_ATOMIC_MAX_LOCK_CYCLES is the length of this window counted from the listing above
+ * (0.5 us at 16 MHz); lds/sts of the extended I/O ports take the same 2 cycles as ld/st.
+ * It bounds the register updates only, not every exclusive area of the driver. Estimated
+ * worst case of each area, in CPU cycles from cli to the SREG restore (counted from the
+ * instruction timings, not measured on the target, DIO_DEV_ERROR_DETECT does not change them):
+ *
+ *     Dio_WriteChannel, Dio_SetupChannelDirection, Dio_FlipChannel,
+ *     Dio_MaskedWritePort, Dio_WriteChannelGroup, Dio_Init (per register),
+ *     Dio_WriteChannels32 / Dio_FlipChannels32 (per port, never across ports),
+ *     Dio_WriteChannelFast / Dio_FlipChannelFast (extended I/O ports only)   8
+ *     the same with DIO_DEFERRED_WRITE (shadow RMW + dirty flag store)       10
+ *     Dio_WritePort with DIO_DEFERRED_WRITE (shadow + dirty flag stores)     6
+ *     Dio_CommitOutputs (per port: flag and shadow, the write is outside)    8
+ *     Dio_ClockRead (TCNT1L / TCNT1H pair)                                   4
+ *     Dio_PlayPattern, Dio_StopPattern, Dio_PwmInit (one flag / pointer)     5
+ *     Dio_GetPatternStatus                                                   12
+ *     Dio_QueuePattern (state checks + buffer pointer and length)            20
+ *     DIO_PROFILING: statistics update at the exit of every service          30
+ *     Dio_ResetStatistics (per service, 6 bins)                              40
+ *     Dio_GetStatistics (copy of one service, 6 bins, +8 per extra bin)      80
+ *     DIO_TRACE: Dio_TraceWrite, nested in the area of the write APIs        40
+ *     Dio_GetTrace (per record)                                              25
+ *
+ * The estimated worst case interrupt latency added by the driver is the longest area of the
+ * services enabled in Dio_Cfg.h: DIO_ATOMIC_MAX_LOCK_CYCLES with the default configuration,
+ * about 50 cycles for a traced register update and about 80 with DIO_PROFILING
+ * (Dio_GetStatistics).
+ *
+ * With constant arguments the inline fast path (Dio_WriteChannelFast) uses a single sbi/cbi
+ * instruction, which is atomic by itself and does not lock at all.
+ */
+#define DIO_ATOMIC_MAX_LOCK_CYCLES     (8U)
+
+#if ((DIO_ATOMIC_ACCESS == STD_ON) && defined(__AVR__) && !defined(DIO_HOST_BACKEND))
+
+/* Saves SREG and disables the interrupts. Opens a block, so it must be closed by
+ * SchM_Exit_Dio_PortAccess() in the same function */
+#define SchM_Enter_Dio_PortAccess() \
+	do { \
+		uint8 Dio_SavedSreg = DIO_REG_READ(&SREG); \
+		__asm__ __volatile__ ("cli" : : : "memory")
+
+/* Restores the saved SREG (and so the previous state of the I flag) */
+#define SchM_Exit_Dio_PortAccess() \
+		DIO_REG_WRITE_RAW(&SREG, Dio_SavedSreg); \
+		__asm__ __volatile__ ("" : : : "memory"); \
+	} while (0)
+
+#else
+
+/* Atomic mode disabled, or host build (single threaded, no interrupts) */
+#define SchM_Enter_Dio_PortAccess()    do {
+#define SchM_Exit_Dio_PortAccess()     } while (0)
+
+#endif
+
+/* =====================================================================================================
+ * 										     TIME BASE
+ * =====================================================================================================*/
+/* Time stamp of the service statistics and of the trace records: Timer1 count on the target
+ * (CPU cycles with prescaler 1), ns on the host build, both wrap at 16 bits */
+LOCAL_INLINE uint16 Dio_ClockRead(void) {
+#if defined(DIO_HOST_BACKEND)
+	return Dio_HostClock();
+#else
+	uint8 Low;
+	uint8 High;
+
+	/* Low byte first, it latches the high byte in the TEMP register shared by all the 16-bit
+	 * timer registers: an ISR accessing one of them between the two reads would change it */
+	SchM_Enter_Dio_PortAccess();
+	Low = DIO_REG_READ(&TCNT1L);
+	High = DIO_REG_READ(&TCNT1H);
+	SchM_Exit_Dio_PortAccess();
+
+	return (uint16)(((uint16)High << 8) | Low);
+#endif
+}
+
+#endif /* SCHM_DIO_H */
@@ -0,0 +1,631 @@
+#!/usr/bin/env python3
+################################################################################
+# DIO configuration generator
+# Reads a pin description (JSON, or a minimal ARXML subset) and emits
+# Dio_Cfg.h and Dio_PBcfg.c with every mask precomputed, so the driver never
+# derives anything from the configuration at runtime.
+#
+#   python3 DioGen.py Dio_Config.json               -> ../Dio/Dio_Cfg.h, ../Dio/Dio_PBcfg.c
+#   python3 DioGen.py Dio_Config.arxml -o out_dir
+#   python3 DioGen.py Dio_Config.json --check       -> exit 1 if the tree is stale
+#   python3 DioGen.py Dio_Config.json --device ATMEGA2560 -o out_dir
+#
+# JSON layout (see Dio_Config.json):
+#   "device"   : "ATMEGA32"|"ATMEGA128"|"ATMEGA2560"        (see DEVICES, default ATMEGA32)
+#   "general"  : { "<switch>": true|false, ... }            (see SWITCHES)
+#   "channels" : [ { "name", "pin": "PIN_C_0", "direction": "OUTPUT"|"INPUT",
+#                    "level": "STD_HIGH"|"STD_LOW", "pullup": true|false,
+#                    "notification": { "edge": "RISING"|"FALLING"|"BOTH",
+#                                      "callback": "<C function>" } }, ... ]
+#   "groups"   : [ { "name", "channels": ["<channel name>", ...] }, ... ]
+#
+# ARXML subset: ECUC-CONTAINER-VALUEs whose DEFINITION-REF ends in
+#   DioGeneral  : boolean parameters named like the SWITCHES macros' ARXML names,
+#                 DioDevice (one of DEVICES)
+#   DioChannel  : DioChannelId ("PIN_C_0" or the channel number), DioChannelDirection,
+#                 DioChannelLevel, DioChannelPullUp, DioChannelNotification (callback)
+#                 and DioChannelNotificationEdge
+#   DioChannelGroup : DioChannelGroupIdentification; REFERENCE-VALUEs to DioChannels
+################################################################################
+
+import argparse
+import json
+import os
+import re
+import sys
+import xml.etree.ElementTree as ET
+from string import Template
+
+PINS_PER_PORT = 8
+
+# Port letters in Port_Id order and pins bonded out on each port, per device (DIO_DEVICE_PORTS and
+# DIO_DEVICE_BONDED_PINS of Dio/MemMap.h list the same ports and masks). The 32-bit images, the
+# notifications and the PWM cover the first IMAGE_PORTS ports (PORTA .. PORTD) on every device
+DEVICES = {
+	"ATMEGA32": ("ABCD", [0xFF] * 4),
+	"ATMEGA128": ("ABCDEFG", [0xFF] * 6 + [0x1F]),
+	"ATMEGA2560": ("ABCDEFGHJKL", [0xFF] * 6 + [0x3F] + [0xFF] * 4),
+}
+DEVICE_IDS = ["ATMEGA32", "ATMEGA128", "ATMEGA2560"]
+IMAGE_PORTS = 4
+
+# (json key, ARXML parameter, macro, default, comment lines, overridable by -D)
+# A boolean default makes an STD_ON/STD_OFF switch, an integer default a numeric parameter
+SWITCHES = [
+	("dev_error_detect", "DioDevErrorDetect", "DIO_DEV_ERROR_DETECT", False,
+	 ["Pre-compile option for Development Error Detect",
+	  "(may be overridden from the command line, e.g. by the benchmark build)"], True),
+	("version_info_api", "DioVersionInfoApi", "DIO_VERSION_INFO_API", True,
+	 ["Pre-compile option for Version Info API"], False),
+	("masked_write_port_api", "DioMaskedWritePortApi", "DIO_MASKED_WRITE_PORT_API", True,
+	 ["Pre-compile option for Masked Write Port API"], False),
+	("config_in_flash", "DioConfigInFlash", "DIO_CONFIG_IN_FLASH", True,
+	 ["Pre-compile option to keep the post-build configuration tables in flash (read with LPM)",
+	  "instead of copying them to SRAM at startup"], False),
+	("inline_api", "DioInlineApi", "DIO_INLINE_API", True,
+	 ["Pre-compile option for the inline fast path APIs (Dio_WriteChannelFast, ...) in Dio.h"], False),
+	("atomic_access", "DioAtomicAccess", "DIO_ATOMIC_ACCESS", True,
+	 ["Pre-compile option for interrupt safe read-modify-write of the PORT / DDR registers",
+	  "(see SchM_Dio.h for the worst case interrupt lock time)"], False),
+	("debounce_api", "DioDebounceApi", "DIO_DEBOUNCE_API", True,
+	 ["Pre-compile option for the input debouncing (Dio_MainFunction, Dio_ReadDebouncedChannel, ...)"], False),
+	("debounce_samples", "DioDebounceSamples", "DIO_DEBOUNCE_SAMPLES", 4,
+	 ["Number of consecutive equal samples (1 .. 8) before a debounced input takes a new level"], False),
+	("notification_api", "DioNotificationApi", "DIO_NOTIFICATION_API", False,
+	 ["Pre-compile option for the edge notifications called from Dio_MainFunction"], False),
+	("deferred_write", "DioDeferredWrite", "DIO_DEFERRED_WRITE", False,
+	 ["Pre-compile option for the deferred outputs: the write APIs update shadows",
+	  "pushed to the ports by Dio_CommitOutputs"], False),
+	("pwm_api", "DioPwmApi", "DIO_PWM_API", False,
+	 ["Pre-compile option for the bit-angle modulation software PWM (Dio_Pwm.h)"], False),
+	("pwm_resolution_bits", "DioPwmResolutionBits", "DIO_PWM_RESOLUTION_BITS", 8,
+	 ["Duty resolution of the software PWM in bits, one timer interrupt per bit (1 .. 8)"], False),
+	("pattern_api", "DioPatternApi", "DIO_PATTERN_API", False,
+	 ["Pre-compile option for the flash pattern players (Dio_Pattern.h)"], False),
+	("profiling", "DioProfiling", "DIO_PROFILING", False,
+	 ["Pre-compile option for the per service statistics (Dio_GetStatistics)"], False),
+	("profiling_bins", "DioProfilingBins", "DIO_PROFILING_BINS", 6,
+	 ["Number of bins of the duration histograms, bin n < (DIO_PROFILING_BIN0_TICKS << n) (1 .. 11)"], False),
+	("trace", "DioTrace", "DIO_TRACE", False,
+	 ["Pre-compile option for the register write trace (Dio_GetTrace)"], False),
+	("trace_records", "DioTraceRecords", "DIO_TRACE_RECORDS", 32,
+	 ["Number of records of the register write trace, 6 bytes each (power of 2, 2 .. 128)"], False),
+]
+
+EDGES = {"RISING": (True, False), "FALLING": (False, True), "BOTH": (True, True)}
+
+
+class ConfigError(Exception):
+	pass
+
+
+def pin_index(pin, ports):
+	"""'PIN_C_0' or 16 -> 16, ports: port letters of the device"""
+	if isinstance(pin, int) or str(pin).isdigit():
+		index = int(pin)
+	else:
+		m = re.match(r"^PIN_([A-Z])_([0-7])$", str(pin))
+		if not m or m.group(1) not in ports:
+			raise ConfigError("invalid pin '%s'" % pin)
+		index = ports.index(m.group(1)) * PINS_PER_PORT + int(m.group(2))
+	if not 0 <= index < len(ports) * PINS_PER_PORT:
+		raise ConfigError("pin %s out of range" % pin)
+	return index
+
+
+def pin_name(index, ports):
+	return "PIN_%s_%d" % (ports[index // PINS_PER_PORT], index % PINS_PER_PORT)
+
+
+def c_name(name):
+	if not re.match(r"^[A-Za-z_][A-Za-z0-9_]*$", name):
+		raise ConfigError("'%s' is not a valid C identifier" % name)
+	return name.upper()
+
+
+def as_bool(value):
+	if isinstance(value, bool):
+		return value
+	return str(value).strip().lower() in ("1", "true", "on", "std_on", "std_high", "output")
+
+
+# ------------------------------------------------------------------------------
+# Input readers: both return {"general": {...}, "channels": [...], "groups": [...]}
+# ------------------------------------------------------------------------------
+def read_json(path):
+	with open(path) as f:
+		return json.load(f)
+
+
+def _local(tag):
+	return tag.rsplit("}", 1)[-1]
+
+
+def _children(elem, name):
+	return [e for e in elem.iter() if _local(e.tag) == name]
+
+
+def _text(elem, name):
+	for e in elem.iter():
+		if _local(e.tag) == name:
+			return (e.text or "").strip()
+	return ""
+
+
+def _params(container):
+	values = {}
+	for param_list in container:
+		if _local(param_list.tag) not in ("PARAMETER-VALUES", "REFERENCE-VALUES"):
+			continue
+		for p in param_list:
+			key = _text(p, "DEFINITION-REF").rsplit("/", 1)[-1]
+			value = _text(p, "VALUE") or _text(p, "VALUE-REF").rsplit("/", 1)[-1]
+			values.setdefault(key, []).append(value)
+	return values
+
+
+def read_arxml(path):
+	root = ET.parse(path).getroot()
+	config = {"general": {}, "channels": [], "groups": []}
+	arxml_switch = {s[1]: s[0] for s in SWITCHES}
+	for container in _children(root, "ECUC-CONTAINER-VALUE"):
+		kind = _text(container, "DEFINITION-REF").rsplit("/", 1)[-1]
+		name = _text(container, "SHORT-NAME")
+		params = _params(container)
+		if kind == "DioGeneral":
+			for key, value in params.items():
+				if key == "DioDevice":
+					config["device"] = value[0]
+				elif key in arxml_switch:
+					default = [s[3] for s in SWITCHES if s[1] == key][0]
+					if isinstance(default, bool):
+						config["general"][arxml_switch[key]] = as_bool(value[0])
+					else:
+						config["general"][arxml_switch[key]] = int(value[0])
+		elif kind == "DioChannel":
+			config["channels"].append({
+				"name": name,
+				"pin": params.get("DioChannelId", [""])[0],
+				"direction": params.get("DioChannelDirection", ["INPUT"])[0],
+				"level": params.get("DioChannelLevel", ["STD_LOW"])[0],
+				"pullup": as_bool(params.get("DioChannelPullUp", ["false"])[0]),
+			})
+			if "DioChannelNotification" in params:
+				config["channels"][-1]["notification"] = {
+					"callback": params["DioChannelNotification"][0],
+					"edge": params.get("DioChannelNotificationEdge", ["BOTH"])[0],
+				}
+		elif kind == "DioChannelGroup":
+			config["groups"].append({"name": name, "channels": params.get("DioChannelRef", [])})
+	return config
+
+
+# ------------------------------------------------------------------------------
+# Derivation: everything the driver needs, computed once here
+# ------------------------------------------------------------------------------
+def derive(config):
+	general = config.get("general", {})
+	for key in general:
+		if key not in [s[0] for s in SWITCHES]:
+			raise ConfigError("unknown general switch '%s'" % key)
+	if not 1 <= int(general.get("debounce_samples", 4)) <= 8:
+		raise ConfigError("debounce_samples must be within 1 .. 8")
+	if not 1 <= int(general.get("pwm_resolution_bits", 8)) <= 8:
+		raise ConfigError("pwm_resolution_bits must be within 1 .. 8")
+	if not 1 <= int(general.get("profiling_bins", 6)) <= 11:
+		raise ConfigError("profiling_bins must be within 1 .. 11")
+	records = int(general.get("trace_records", 32))
+	if not 2 <= records <= 128 or records & (records - 1):
+		raise ConfigError("trace_records must be a power of 2 within 2 .. 128")
+	if as_bool(general.get("deferred_write", False)) and \
+			(as_bool(general.get("pwm_api", False)) or as_bool(general.get("pattern_api", False))):
+		raise ConfigError("deferred_write cannot be combined with pwm_api or pattern_api")
+
+	device = str(config.get("device", "ATMEGA32")).upper()
+	if device not in DEVICES:
+		raise ConfigError("device must be one of %s" % ", ".join(DEVICE_IDS))
+	letters, bonded = DEVICES[device]
+
+	ports = [{"configured": 0, "direction": 0, "level": 0, "pullup": 0,
+	          "rising": 0, "falling": 0, "channels": []} for _ in letters]
+	callbacks = [None] * (IMAGE_PORTS * PINS_PER_PORT)
+	channels = {}
+	for ch in config.get("channels", []):
+		name = c_name(ch["name"])
+		index = pin_index(ch["pin"], letters)
+		if name in channels:
+			raise ConfigError("channel '%s' defined twice" % name)
+		for other, (other_index, _) in channels.items():
+			if other_index == index:
+				raise ConfigError("%s used by both %s and %s" % (pin_name(index, letters), other, name))
+		if not (bonded[index // PINS_PER_PORT] >> (index % PINS_PER_PORT)) & 1:
+			raise ConfigError("channel '%s': %s is not bonded out on the %s"
+			                  % (name, pin_name(index, letters), device))
+		direction = str(ch.get("direction", "INPUT")).upper()
+		if direction not in ("INPUT", "OUTPUT"):
+			raise ConfigError("channel '%s': direction must be INPUT or OUTPUT" % name)
+		level = as_bool(ch.get("level", "STD_LOW"))
+		pullup = as_bool(ch.get("pullup", False))
+		if direction == "OUTPUT" and pullup:
+			raise ConfigError("channel '%s': pull-up on an output" % name)
+		port = ports[index // PINS_PER_PORT]
+		bit = 1 << (index % PINS_PER_PORT)
+		port["configured"] |= bit
+		if direction == "OUTPUT":
+			port["direction"] |= bit
+			if level:
+				port["level"] |= bit
+		elif pullup:
+			port["pullup"] |= bit
+		port["channels"].append(index)
+		channels[name] = (index, direction)
+
+		notification = ch.get("notification")
+		if notification:
+			edge = str(notification.get("edge", "BOTH")).upper()
+			callback = str(notification.get("callback", ""))
+			if edge not in EDGES:
+				raise ConfigError("channel '%s': edge must be RISING, FALLING or BOTH" % name)
+			if not re.match(r"^[A-Za-z_][A-Za-z0-9_]*$", callback):
+				raise ConfigError("channel '%s': invalid notification callback '%s'" % (name, callback))
+			if index >= len(callbacks):
+				raise ConfigError("channel '%s': notifications are limited to PORTA .. PORTD" % name)
+			rising, falling = EDGES[edge]
+			if rising:
+				port["rising"] |= bit
+			if falling:
+				port["falling"] |= bit
+			callbacks[index] = callback
+
+	groups = []
+	for grp in config.get("groups", []):
+		name = c_name(grp["name"])
+		members = []
+		for ref in grp["channels"]:
+			key = c_name(ref)
+			if key not in channels:
+				raise ConfigError("group '%s' references unknown channel '%s'" % (name, ref))
+			members.append(channels[key][0])
+		if not members:
+			raise ConfigError("group '%s' is empty" % name)
+		members.sort()
+		port = members[0] // PINS_PER_PORT
+		if any(m // PINS_PER_PORT != port for m in members):
+			raise ConfigError("group '%s' spans more than one port" % name)
+		if members != list(range(members[0], members[-1] + 1)):
+			raise ConfigError("group '%s' channels are not adjoining" % name)
+		offset = members[0] % PINS_PER_PORT
+		mask = ((1 << len(members)) - 1) << offset
+		groups.append({"name": name, "port": port, "offset": offset, "mask": mask,
+		               "first": members[0], "last": members[-1]})
+
+	return device, general, ports, callbacks, channels, groups
+
+
+# ------------------------------------------------------------------------------
+# Emitters
+# ------------------------------------------------------------------------------
+def emit_switches(general):
+	lines = []
+	for key, _, macro, default, comment, overridable in SWITCHES:
+		if isinstance(default, bool):
+			value = "STD_ON" if general.get(key, default) else "STD_OFF"
+		else:
+			value = "%dU" % int(general.get(key, default))
+		lines.append("/* " + ("\n * ".join(comment)) + " */")
+		define = "#define %-35s (%s)" % (macro, value)
+		if overridable:
+			lines += ["#ifndef " + macro, define, "#endif"]
+		else:
+			lines.append(define)
+		lines.append("")
+	return "\n".join(lines)
+
+
+def emit_cfg_device(device):
+	lines = ["/* Target device, selects the register map of MemMap.h (ports, register addresses) */"]
+	lines += ["#define %-35s (%dU)" % ("DIO_DEVICE_" + d, i) for i, d in enumerate(DEVICE_IDS)]
+	lines.append("#define %-35s (DIO_DEVICE_%s)" % ("DIO_DEVICE", device))
+	return "\n".join(lines) + "\n"
+
+
+def emit_cfg_counts(device):
+	letters = DEVICES[device][0]
+	count = len(letters) * PINS_PER_PORT
+	return "\n".join([
+		"#define DIO_CONFIGURED_PORTS       \t        (%dU)  /*%s*/" % (len(letters), ", ".join(letters)),
+		"#define DIO_TOTAL_CHANNLES        \t        (%dU)" % count,
+		"#define DIO_CONFIGURED_CHANNLES             (%dU) /* %d PORTS * %d PINS = %d Channels*/"
+		% (count, len(letters), PINS_PER_PORT, count)])
+
+
+def emit_cfg_port_ids(device):
+	letters = DEVICES[device][0]
+	return "\n".join("#define %-33s (uint8)0x%02X" % ("PORT%s_ID" % l, i + 1) for i, l in enumerate(letters))
+
+
+def emit_cfg_pin_ids(device):
+	letters = DEVICES[device][0]
+	return "\n".join("#define    %-15s %-2d // %d" % (pin_name(i, letters), i, i % PINS_PER_PORT)
+	                 for i in range(len(letters) * PINS_PER_PORT))
+
+
+def emit_cfg_groups(groups, letters):
+	lines = ["/* Number of the configured Dio Channel Groups */",
+	         "#define %-35s (%dU)" % ("DIO_CONFIGURED_GROUPS", len(groups)),
+	         "",
+	         "/* Channel Group Handles (to be passed to Dio_ReadChannelGroup / Dio_WriteChannelGroup) */"]
+	for i, g in enumerate(groups):
+		lines.append("#define %-35s (&Dio_ChannelGroups[%d]) /* %s .. %s */"
+		             % ("DIO_GROUP_" + g["name"], i, pin_name(g["first"], letters), pin_name(g["last"], letters)))
+	return "\n".join(lines) + "\n"
+
+
+def emit_cfg_channels(channels, letters):
+	if not channels:
+		return ""
+	lines = ["/* Configured Channel Handles: <name>_PORT / <name>_PIN for the port based APIs,",
+	         " * <name> (0..31) for the channel based APIs */"]
+	for name, (index, direction) in sorted(channels.items(), key=lambda c: c[1][0]):
+		port = letters[index // PINS_PER_PORT]
+		lines.append("#define    DIO_CHANNEL_%-20s %-10s /* %s */" % (name, pin_name(index, letters), direction))
+		lines.append("#define    DIO_CHANNEL_%-20s PORT%s_ID" % (name + "_PORT", port))
+		lines.append("#define    DIO_CHANNEL_%-20s PIN%d_ID" % (name + "_PIN", index % PINS_PER_PORT))
+	return "\n".join(lines) + "\n\n"
+
+
+def emit_pb_ports(ports, callbacks, notification_api, letters):
+	lines = []
+	notified = [(index, callback) for index, callback in enumerate(callbacks) if callback]
+	if notification_api and notified:
+		lines.append("/* Edge notifications, implemented by the upper layers */")
+		lines += ["extern void %s(Dio_ChannelType Channel_Id, Dio_LevelType Level);" % n
+		          for n in sorted(set(c for _, c in notified))]
+		lines += ["",
+		          "/* Notified channels of Dio_ConfigurationSet, sorted by channel ID */",
+		          "STATIC DIO_CONFIG_CONST Dio_ChannelNotificationType Dio_ChannelNotifications[%dU] = {"
+		          % len(notified)]
+		for i, (index, callback) in enumerate(notified):
+			sep = "," if i < len(notified) - 1 else ""
+			lines.append("\t{%s, %s}%s" % (pin_name(index, letters), callback, sep))
+		lines += ["};", ""]
+	lines += ["/* PB structure used with Dio_Init API (bit packed, 4 bytes per port%s) */"
+	          % (", then the edge notifications" if notification_api else ""),
+	          "DIO_CONFIG_CONST Dio_ConfigType Dio_ConfigurationSet = {{",
+	          "\t  /* Configured,           Direction (OUTPUT),   Level (STD_HIGH),     PullUp*/"]
+	for i, p in enumerate(ports):
+		cells = ["0x%02XU," % p["configured"], "0x%02XU," % p["direction"],
+		         "0x%02XU," % p["level"], "0x%02XU" % p["pullup"]]
+		sep = "," if i < len(ports) - 1 else " "
+		note = ": " + ", ".join(pin_name(c, letters) for c in sorted(p["channels"])) if p["channels"] else ""
+		lines.append("\t{%-22s %-21s %-21s %s}%s /* PORT%s%s */"
+		             % (cells[0], cells[1], cells[2], cells[3], sep, letters[i], note))
+	if not notification_api:
+		lines.append("}};")
+		return "\n".join(lines) + "\n"
+
+	lines += ["}, {",
+	          "\t/* Rising edge notified channels: PORTA, PORTB, PORTC, PORTD */",
+	          "\t{" + ", ".join("0x%02XU" % p["rising"] for p in ports[:IMAGE_PORTS]) + "},",
+	          "\t/* Falling edge notified channels: PORTA, PORTB, PORTC, PORTD */",
+	          "\t{" + ", ".join("0x%02XU" % p["falling"] for p in ports[:IMAGE_PORTS]) + "},",
+	          "\t/* Table and number of the notified channels */"]
+	if notified:
+		lines.append("\tDio_ChannelNotifications, %dU" % len(notified))
+	else:
+		lines.append("\tNULL_PTR, 0U")
+	lines.append("}};")
+	return "\n".join(lines) + "\n"
+
+
+def emit_pb_groups(groups, letters):
+	lines = ["/* PB structure used with Dio_ReadChannelGroup / Dio_WriteChannelGroup APIs */"]
+	if not groups:
+		return lines[0] + "\n/* No channel groups configured */\n"
+	lines += ["DIO_CONFIG_CONST Dio_ChannelGroupType Dio_ChannelGroups[DIO_CONFIGURED_GROUPS] = {",
+	          "\t  /* mask,  offset,  port*/"]
+	for i, g in enumerate(groups):
+		sep = "," if i < len(groups) - 1 else " "
+		lines.append("\t{0x%02XU,   %dU,      PORT%s_ID}%s /* DIO_GROUP_%s : %s .. %s */"
+		             % (g["mask"], g["offset"], letters[g["port"]], sep, g["name"],
+		                pin_name(g["first"], letters), pin_name(g["last"], letters)))
+	lines.append("};")
+	return "\n".join(lines) + "\n"
+
+
+def generate(config, source):
+	device, general, ports, callbacks, channels, groups = derive(config)
+	letters = DEVICES[device][0]
+	note = "/* Generated by Generator/DioGen.py from %s -- edit the description and regenerate */\n" % source
+	cfg = Template(CFG_TEMPLATE).substitute(
+		note=note, switches=emit_switches(general), device=emit_cfg_device(device),
+		counts=emit_cfg_counts(device), groups=emit_cfg_groups(groups, letters),
+		port_ids=emit_cfg_port_ids(device), pin_ids=emit_cfg_pin_ids(device),
+		channels=emit_cfg_channels(channels, letters))
+	pb = Template(PBCFG_TEMPLATE).substitute(
+		note=note, ports=emit_pb_ports(ports, callbacks, general.get("notification_api", False), letters),
+		groups=emit_pb_groups(groups, letters))
+	return {"Dio_Cfg.h": cfg, "Dio_PBcfg.c": pb}
+
+
+def main():
+	here = os.path.dirname(os.path.abspath(__file__))
+	parser = argparse.ArgumentParser(description="Generate Dio_Cfg.h / Dio_PBcfg.c")
+	parser.add_argument("description", help="pin description (.json or .arxml)")
+	parser.add_argument("-o", "--out", default=os.path.join(here, "..", "Dio"),
+	                    help="output directory (default: ../Dio)")
+	parser.add_argument("--check", action="store_true",
+	                    help="do not write, fail if the output directory is out of date")
+	parser.add_argument("--device", choices=DEVICE_IDS,
+	                    help="generate for this device instead of the one of the description")
+	args = parser.parse_args()
+
+	try:
+		if args.description.lower().endswith(".arxml"):
+			config = read_arxml(args.description)
+		else:
+			config = read_json(args.description)
+		if args.device:
+			config["device"] = args.device
+		files = generate(config, os.path.basename(args.description))
+	except (ConfigError, KeyError, ValueError, ET.ParseError) as e:
+		sys.stderr.write("DioGen: %s: %s\n" % (args.description, e))
+		return 1
+
+	stale = []
+	for name, text in files.items():
+		path = os.path.join(args.out, name)
+		old = open(path, newline="").read() if os.path.exists(path) else None
+		if old == text:
+			continue
+		stale.append(path)
+		if not args.check:
+			with open(path, "w", newline="") as f:
+				f.write(text)
+	for path in stale:
+		print(("stale: " if args.check else "wrote: ") + path)
+	return 1 if (args.check and stale) else 0
+
+
+# ------------------------------------------------------------------------------
+# Output templates (hand written parts of the two files)
+# ------------------------------------------------------------------------------
+CFG_TEMPLATE = r''' /*======================================================================================================
+ * Module: DIO																							*															*
+ * File Name: Dio_Cfg.h																					*																*
+ * Description: Pre-Compile Configuration Header file for AVR ATmega32 Microcontroller- Dio Driver		*
+ * Author: Mahmoud-Helmy																				*
+ *======================================================================================================*/
+${note}/* =====================================================================================================
+ * 											 FILE GUARD
+ * =====================================================================================================*/
+#ifndef DIO_CFG_H
+#define DIO_CFG_H
+/* =====================================================================================================
+ * 										VERSION DEFINITION
+ * =====================================================================================================*/
+/*
+ * Module Version 1.0.0
+ */
+#define DIO_CFG_SW_MAJOR_VERSION              (1U)
+#define DIO_CFG_SW_MINOR_VERSION              (0U)
+#define DIO_CFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define DIO_CFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define DIO_CFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define DIO_CFG_AR_RELEASE_PATCH_VERSION     (3U)
+/* =====================================================================================================
+ * 											INCLUDES
+ * =====================================================================================================*/
+/* Standard AUTOSAR types */
+#include "../LIB/Std_Types.h"
+/* =====================================================================================================
+ * 								          VERSION CHECK
+ * =====================================================================================================*/
+/* AUTOSAR checking between Std Types and Dio Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != DIO_CFG_AR_RELEASE_MAJOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_MINOR_VERSION != DIO_CFG_AR_RELEASE_MINOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_PATCH_VERSION != DIO_CFG_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Std_Types.h does not match the expected version"
+#endif
+/* =====================================================================================================
+ * 								    Configuration Parameters
+ * =====================================================================================================*/
+${switches}
+${device}
+
+#define INPUT                              (uint8)0x00
+#define OUTPUT                             (uint8)0x01
+#define PIN_INPUT                          (uint8)0x00
+#define PIN_OUTPUT                         (uint8)0x01
+
+
+/* Number of the configured Dio Channels */
+${counts}
+#define NUM_OF_PINS_IN_SINGLE_PORT			(8U)
+
+${groups}
+
+${port_ids}
+
+/* Port Input Pins (generic) */
+#define    PIN0         0
+#define    PIN1         1
+#define    PIN2         2
+#define    PIN3         3
+#define    PIN4         4
+#define    PIN5         5
+#define    PIN6         6
+#define    PIN7         7
+
+/* Port Input Pins (generic) */
+#define    PIN0_ID         0
+#define    PIN1_ID         1
+#define    PIN2_ID         2
+#define    PIN3_ID         3
+#define    PIN4_ID         4
+#define    PIN5_ID         5
+#define    PIN6_ID         6
+#define    PIN7_ID         7
+
+/* Port Input Pins (generic) */
+${pin_ids}
+
+${channels}#endif /* DIO_CFG_H */
+'''
+
+PBCFG_TEMPLATE = r''' /*======================================================================================================
+ * Module: DIO																							*															*
+ * File Name: Dio_PBcfg.c																				*																*
+ * Description: Post Build Configuration Source file for AVR ATmega32 Microcontroller - DIO Driver		*
+ * Author: Mahmoud-Helmy																				*
+ *======================================================================================================*/
+${note}/* =====================================================================================================
+ * 											   INCLUDES
+ * =====================================================================================================*/
+#include "Dio.h"
+#include "MemMap.h"
+#include "../LIB/Std_Types.h"
+/* =====================================================================================================
+ * 										VERSION DEFINITION
+ * =====================================================================================================*/
+/*
+ * Module Version 1.0.0
+ */
+#define DIO_PBCFG_SW_MAJOR_VERSION              (1U)
+#define DIO_PBCFG_SW_MINOR_VERSION              (0U)
+#define DIO_PBCFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define DIO_PBCFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define DIO_PBCFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define DIO_PBCFG_AR_RELEASE_PATCH_VERSION     (3U)
+/* =====================================================================================================
+ * 										VERSION CHECK
+ * =====================================================================================================*/
+/* AUTOSAR Version checking between Dio_PBcfg.c and Dio.h files */
+#if ((DIO_PBCFG_AR_RELEASE_MAJOR_VERSION != DIO_AR_RELEASE_MAJOR_VERSION)\
+ ||  (DIO_PBCFG_AR_RELEASE_MINOR_VERSION != DIO_AR_RELEASE_MINOR_VERSION)\
+ ||  (DIO_PBCFG_AR_RELEASE_PATCH_VERSION != DIO_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of PBcfg.c does not match the expected version"
+#endif
+
+/* Software Version checking between Dio_PBcfg.c and Dio.h files */
+#if ((DIO_PBCFG_SW_MAJOR_VERSION != DIO_SW_MAJOR_VERSION)\
+ ||  (DIO_PBCFG_SW_MINOR_VERSION != DIO_SW_MINOR_VERSION)\
+ ||  (DIO_PBCFG_SW_PATCH_VERSION != DIO_SW_PATCH_VERSION))
+  #error "The SW version of PBcfg.c does not match the expected version"
+#endif
+
+
+${ports}
+${groups}'''
+
+
+if __name__ == "__main__":
+	sys.exit(main())
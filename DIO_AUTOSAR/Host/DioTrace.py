@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+################################################################################
+# DIO register write trace decoder
+# Turns a dump of the records copied by Dio_GetTrace (DIO_TRACE == STD_ON)
+# into a readable timeline. The register and service names are taken from
+# MemMap.h (register map of the DIO_DEVICE of Dio_Cfg.h) and Dio.h, so the
+# decoder follows the driver sources.
+#
+#   python3 DioTrace.py trace.bin                   -> binary dump (fwrite of the records)
+#   python3 DioTrace.py --hex trace.txt             -> hex bytes, e.g. a debugger memory view
+#   python3 DioTrace.py trace.bin --tick-ns 125     -> times in us (Timer1 at F_CPU / 1)
+#
+# Record layout (Dio_TraceRecordType, 6 bytes, little endian, oldest first):
+#   uint16 Time      Dio_ClockRead() before the write (Timer1 ticks, ns on the host)
+#   uint8  Address   data space address of the register (low byte)
+#   uint8  Service   DIO_*_SID of the writing service, 0xFF outside of a service
+#   uint8  Old, New  register value before and after the write
+################################################################################
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+DIO_DIR = os.path.join(HERE, "..", "Dio")
+
+RECORD = struct.Struct("<HBBBB")
+NO_SERVICE = 0xFF
+
+
+def load_names(path, pattern):
+	"""Maps the values matched by pattern in path to their names."""
+	names = {}
+	with open(path) as f:
+		for name, value in re.findall(pattern, f.read()):
+			names.setdefault(int(value, 16), name)
+	return names
+
+
+def load_registers():
+	"""Maps the low address byte of the registers of the configured device to their names."""
+	with open(os.path.join(DIO_DIR, "Dio_Cfg.h")) as f:
+		device = re.search(r"#define\s+DIO_DEVICE\s+\(?DIO_DEVICE_(\w+)\)?", f.read()).group(1)
+	with open(os.path.join(DIO_DIR, "MemMap.h")) as f:
+		# [common part, device, block, device, block, ...], the last block ends at its #else
+		parts = re.split(r"^#(?:el)?if \(DIO_DEVICE == DIO_DEVICE_(\w+)\)\s*$", f.read(), flags=re.M)
+	text = parts[0] + dict(zip(parts[1::2], parts[2::2]))[device].split("\n#else")[0]
+	names = {}
+	for name, value in re.findall(r"#define\s+(\w+)\s+DIO_REGISTER\((0[xX][0-9A-Fa-f]+)\)", text):
+		names.setdefault(int(value, 16) & 0xFF, name)
+	return names
+
+
+def read_dump(path, as_hex):
+	if as_hex:
+		with open(path) as f:
+			text = re.sub(r"0[xX]", "", f.read())
+		data = bytes(int(byte, 16) for byte in re.findall(r"[0-9A-Fa-f]{2}", text))
+	else:
+		with open(path, "rb") as f:
+			data = f.read()
+	if len(data) % RECORD.size:
+		sys.stderr.write("warning: %d trailing bytes ignored\n" % (len(data) % RECORD.size))
+	return [RECORD.unpack_from(data, offset)
+	        for offset in range(0, len(data) - RECORD.size + 1, RECORD.size)]
+
+
+def changed_bits(old, new):
+	bits = [str(bit) + ("+" if new & (1 << bit) else "-")
+	        for bit in range(7, -1, -1) if (old ^ new) & (1 << bit)]
+	return " ".join(bits) if bits else "(no change)"
+
+
+def main():
+	parser = argparse.ArgumentParser(description="Decode a DIO register write trace")
+	parser.add_argument("dump", help="records copied by Dio_GetTrace, oldest first")
+	parser.add_argument("--hex", action="store_true", help="the dump is hex text")
+	parser.add_argument("--tick-ns", type=float, default=None,
+	                    help="length of a time tick in ns (times are printed in ticks without it)")
+	args = parser.parse_args()
+
+	registers = load_registers()
+	services = load_names(os.path.join(DIO_DIR, "Dio.h"),
+	                      r"#define\s+(DIO_\w+)_SID\s+\(uint8\)(0x[0-9A-Fa-f]+)")
+
+	records = read_dump(args.dump, args.hex)
+	unit = "ticks" if args.tick_ns is None else "us"
+	print("%12s %10s  %-8s %-28s %-9s %s" % ("time[" + unit + "]", "delta", "register",
+	                                         "service", "old->new", "changed bits"))
+	now = 0
+	previous = None
+	for time, address, service, old, new in records:
+		# 16 bit time base: the delta is exact as long as two writes are closer than one wrap
+		delta = 0 if previous is None else (time - previous) & 0xFFFF
+		previous = time
+		now += delta
+		if args.tick_ns is None:
+			stamp, step = "%d" % now, "+%d" % delta
+		else:
+			stamp, step = "%.3f" % (now * args.tick_ns / 1000.0), "+%.3f" % (delta * args.tick_ns / 1000.0)
+		register = registers.get(address, "0x%02X" % address)
+		if NO_SERVICE == service:
+			name = "-"
+		else:
+			name = services.get(service, "0x%02X" % service).replace("DIO_", "", 1)
+		print("%12s %10s  %-8s %-28s %02X->%02X     %s" % (stamp, step, register, name,
+		                                                old, new, changed_bits(old, new)))
+	return 0
+
+
+if __name__ == "__main__":
+	sys.exit(main())
@@ -0,0 +1,118 @@
+/*======================================================================================================
+ * Module: DIO																							*
+ * File Name: Dio_Host.c																				*
+ * Description: Host register backend for the DIO Driver (simulated AVR register file)				*
+ * Author: Mahmoud-Helmy																				*
+ *======================================================================================================*/
+/* =====================================================================================================
+ * 											   INCLUDES
+ * =====================================================================================================*/
+#include <time.h>
+
+#include "Dio_Host.h"
+#include "../Dio/MemMap.h"
+
+#if !defined(DIO_HOST_BACKEND)
+  #error "Dio_Host.c is only part of the host build (DIO_HOST_BACKEND)"
+#endif
+
+/* =====================================================================================================
+ * 							                GLOBAL VARIABLES
+ * =====================================================================================================*/
+volatile uint8 Dio_HostRegisterFile[DIO_HOST_REGISTER_FILE_SIZE];
+
+/* Level driven on the pins from outside of the device, indexed by (Port_Id - PORTA_ID) */
+STATIC uint8 Dio_HostInputs[DIO_CONFIGURED_PORTS];
+
+/* Registers of each port of the device, indexed by (Port_Id - PORTA_ID) */
+STATIC volatile uint8 * const Dio_HostPort[DIO_CONFIGURED_PORTS] = { DIO_DEVICE_PORTS(DIO_DEVICE_REG_ENTRY, PORT) };
+STATIC volatile uint8 * const Dio_HostPin[DIO_CONFIGURED_PORTS]  = { DIO_DEVICE_PORTS(DIO_DEVICE_REG_ENTRY, PIN) };
+STATIC volatile uint8 * const Dio_HostDdr[DIO_CONFIGURED_PORTS]  = { DIO_DEVICE_PORTS(DIO_DEVICE_REG_ENTRY, DDR) };
+
+/**
+ * @brief Returns the port index of a PINx register.
+ * @param Reg Address of a register inside the simulated register file.
+ * @return The port index, or DIO_CONFIGURED_PORTS if Reg is not a PINx register.
+ */
+STATIC uint8 getPinPortIndex(const volatile uint8 *Reg) {
+	uint8 PortIndex = 0U;
+
+	while ((PortIndex < DIO_CONFIGURED_PORTS) && (Dio_HostPin[PortIndex] != Reg)) {
+		++PortIndex;
+	}
+	return PortIndex;
+}
+
+/**
+ * @brief Returns the port index of a PORTx or DDRx register.
+ * @param Reg Address of a register inside the simulated register file.
+ * @return The port index, or DIO_CONFIGURED_PORTS if Reg is neither a PORTx nor a DDRx register.
+ */
+STATIC uint8 getOutputPortIndex(const volatile uint8 *Reg) {
+	uint8 PortIndex = 0U;
+
+	while ((PortIndex < DIO_CONFIGURED_PORTS) && (Dio_HostPort[PortIndex] != Reg) && (Dio_HostDdr[PortIndex] != Reg)) {
+		++PortIndex;
+	}
+	return PortIndex;
+}
+
+/* =====================================================================================================
+ * 												 APIs
+ * =====================================================================================================*/
+void Dio_HostReset(void) {
+	for (uint16 Address = 0U; Address < DIO_HOST_REGISTER_FILE_SIZE; ++Address) {
+		Dio_HostRegisterFile[Address] = 0x00U;
+	}
+	for (uint8 PortIndex = 0U; PortIndex < DIO_CONFIGURED_PORTS; ++PortIndex) {
+		Dio_HostInputs[PortIndex] = 0x00U;
+		Dio_HostVcdPort(PortIndex);
+	}
+}
+
+void Dio_HostSetInputs(uint8 Port_Id, uint8 Level) {
+	uint8 PortIndex = (uint8)(Port_Id - PORTA_ID);
+
+	if (PortIndex < DIO_CONFIGURED_PORTS) {
+		Dio_HostInputs[PortIndex] = Level;
+		Dio_HostVcdPort(PortIndex);
+	} else {
+		/* Do Nothing */
+	}
+}
+
+uint8 Dio_HostRead(const volatile uint8 *Reg) {
+	uint8 PortIndex = getPinPortIndex(Reg);
+
+	if (PortIndex < DIO_CONFIGURED_PORTS) {
+		/* Output pins read back their PORT latch, input pins the external level */
+		uint8 Ddr = *Dio_HostDdr[PortIndex];
+		*Dio_HostPin[PortIndex] = (uint8)((*Dio_HostPort[PortIndex] & Ddr) | (Dio_HostInputs[PortIndex] & (uint8)(~Ddr)));
+	} else {
+		/* Do Nothing */
+	}
+	return *Reg;
+}
+
+void Dio_HostWrite(volatile uint8 *Reg, uint8 Value) {
+	if (getPinPortIndex(Reg) < DIO_CONFIGURED_PORTS) {
+		/* PINx is read only on the ATmega32 */
+	} else {
+		uint8 PortIndex = getOutputPortIndex(Reg);
+
+		*Reg = Value;
+		if (PortIndex < DIO_CONFIGURED_PORTS) {
+			Dio_HostVcdPort(PortIndex);
+		} else {
+			/* Do Nothing */
+		}
+	}
+}
+
+uint16 Dio_HostClock(void) {
+	struct timespec Now;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &Now);
+	/* Full ns count: tv_nsec alone wraps at 10^9, which is not a multiple of 2^16 */
+	return (uint16)(((uint64)Now.tv_sec * 1000000000ULL) + (uint64)Now.tv_nsec);
+}
@@ -0,0 +1,79 @@
+/*======================================================================================================
+ * Module: DIO																							*
+ * File Name: Dio_Host.h																				*
+ * Description: Host register backend for the DIO Driver (simulated AVR register file)				*
+ * Author: Mahmoud-Helmy																				*
+ *======================================================================================================*/
+/* =====================================================================================================
+ * 											 FILE GUARD
+ * =====================================================================================================*/
+#ifndef DIO_HOST_H
+#define DIO_HOST_H
+
+/* =====================================================================================================
+ * 											INCLUDES
+ * =====================================================================================================*/
+/* Standard AUTOSAR types */
+#include "../LIB/Std_Types.h"
+
+/* Port IDs */
+#include "../Dio/Dio_Cfg.h"
+
+/* Also called from the register accessors of Dio.hpp */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* =====================================================================================================
+ * 										   DEFINITIONS
+ * =====================================================================================================*/
+/* Size of the simulated data space: 32 CPU registers, 64 I/O registers and the extended I/O
+ * registers of the larger devices (0x00 .. 0x1FF, PORTL of the ATmega2560 is at 0x10B) */
+#define DIO_HOST_REGISTER_FILE_SIZE        (0x200U)
+
+/* =====================================================================================================
+ *                                      EXTERNAL VARIABLES
+ * =====================================================================================================*/
+/* Simulated register file, indexed by the data space address used in MemMap.h */
+extern volatile uint8 Dio_HostRegisterFile[DIO_HOST_REGISTER_FILE_SIZE];
+
+/* =====================================================================================================
+ * 							            FUNCTION PROTOTYPES
+ * =====================================================================================================*/
+/* Resets the simulated register file and the external pin levels to their reset value (0x00) */
+void Dio_HostReset(void);
+
+/* Drives the external level of the pins of a port (PORTA_ID .. last port of DIO_DEVICE),
+ * visible in PINx for the pins configured as input */
+void Dio_HostSetInputs(uint8 Port_Id, uint8 Level);
+
+/* Register read used by DIO_REG_READ, PINx returns the simulated physical level of the pins */
+uint8 Dio_HostRead(const volatile uint8 *Reg);
+
+/* Register write used by DIO_REG_WRITE, writes to PINx are ignored as on the ATmega32 (the pin
+ * toggle of the newer devices is not simulated) */
+void Dio_HostWrite(volatile uint8 *Reg, uint8 Value);
+
+/* Monotonic clock in ns (wraps at 16 bits), time base of the service statistics (DIO_PROFILING) */
+uint16 Dio_HostClock(void);
+
+/* Starts a Value Change Dump of all the pins of the device and of the PORTx / DDRx registers
+ * to Path, at the current simulation time (Dio_HostVcd.c). E_NOT_OK if the file cannot be created */
+Std_ReturnType Dio_HostVcdOpen(const char *Path);
+
+/* Writes the buffered changes and closes the dump */
+void Dio_HostVcdClose(void);
+
+/* Advances the simulation time of the dump (1 ns resolution); a register write is stamped with the
+ * simulation time it happens at, so the test bench calls this between the driver calls */
+void Dio_HostAdvanceTime(uint32 Ns);
+
+/* Records the current PORTx / DDRx / PINx state of a port (index Port_Id - PORTA_ID) in the dump,
+ * called by Dio_HostWrite and Dio_HostSetInputs */
+void Dio_HostVcdPort(uint8 PortIndex);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DIO_HOST_H */
@@ -0,0 +1,178 @@
+/*======================================================================================================
+ * Module: DIO																							*
+ * File Name: Dio_HostTest.c																			*
+ * Description: Host test of the DIO Driver, checks the simulated register file after every service		*
+ *              Core services here, one Dio_HostTest<Feature>.c suite per optional feature				*
+ * Author: Mahmoud-Helmy																				*
+ *======================================================================================================*/
+/* =====================================================================================================
+ * 											   INCLUDES
+ * =====================================================================================================*/
+#include "Dio_HostTest.h"
+
+/* =====================================================================================================
+ * 							                GLOBAL VARIABLES
+ * =====================================================================================================*/
+uint32 Dio_HostTestChecks = 0U;
+uint32 Dio_HostTestFailures = 0U;
+
+volatile uint8 * const Dio_HostTestPort[DIO_CONFIGURED_PORTS] = { DIO_DEVICE_PORTS(DIO_DEVICE_REG_ENTRY, PORT) };
+volatile uint8 * const Dio_HostTestDdr[DIO_CONFIGURED_PORTS]  = { DIO_DEVICE_PORTS(DIO_DEVICE_REG_ENTRY, DDR) };
+
+/* =====================================================================================================
+ * 										  HELPERS
+ * =====================================================================================================*/
+void Dio_HostTestCommit(void) {
+#if (DIO_DEFERRED_WRITE == STD_ON)
+	Dio_CommitOutputs();
+#endif
+}
+
+#if (DIO_DEBOUNCE_API == STD_ON) || (DIO_NOTIFICATION_API == STD_ON)
+void Dio_HostTestMainFunction(uint8 Count) {
+	for (uint8 Call = 0U; Call < Count; ++Call) {
+		Dio_MainFunction();
+	}
+}
+#endif
+
+/* =====================================================================================================
+ * 											 TESTS
+ * =====================================================================================================*/
+void Dio_HostTestInit(void) {
+	/* Services called before Dio_Init */
+	Dio_WriteChannel(PORTC_ID, PIN0_ID, STD_LOW);
+	HOST_TEST_CHECK_DET(DIO_E_UNINIT);
+	HOST_TEST_CHECK(PORTC == 0x00U);
+	(void)Dio_ReadPort(PORTD_ID);
+	HOST_TEST_CHECK_DET(DIO_E_UNINIT);
+
+	Dio_Init(NULL_PTR);
+	HOST_TEST_CHECK_DET(DIO_E_PARAM_CONFIG);
+
+	Dio_Init(&Dio_ConfigurationSet);
+	HOST_TEST_CHECK_DET(0U);
+
+	/* Latch and direction of the configured channels, pull-up of KEY_D0 */
+	HOST_TEST_CHECK(PORTA == 0x01U);
+	HOST_TEST_CHECK(DDRA == 0x3FU);
+	HOST_TEST_CHECK(PORTB == 0x00U);
+	HOST_TEST_CHECK(DDRB == 0xFFU);
+	HOST_TEST_CHECK(PORTC == 0x07U);
+	HOST_TEST_CHECK(DDRC == 0x07U);
+	HOST_TEST_CHECK(PORTD == 0x01U);
+	HOST_TEST_CHECK(DDRD == 0x00U);
+
+	/* Ports without configured channels are not touched */
+	for (uint8 PortIndex = 4U; PortIndex < DIO_CONFIGURED_PORTS; ++PortIndex) {
+		HOST_TEST_CHECK(*Dio_HostTestPort[PortIndex] == 0x00U);
+		HOST_TEST_CHECK(*Dio_HostTestDdr[PortIndex] == 0x00U);
+	}
+}
+
+void Dio_HostTestChannels(void) {
+	/* Local and global channel IDs */
+	Dio_WriteChannel(PORTC_ID, PIN0_ID, STD_LOW);
+	Dio_WriteChannel(PORTC_ID, PIN_C_1, STD_LOW);
+	Dio_HostTestCommit();
+	HOST_TEST_CHECK(PORTC == 0x04U);
+	HOST_TEST_CHECK(Dio_ReadChannel(PORTC_ID, PIN0_ID) == STD_LOW);
+	HOST_TEST_CHECK(Dio_ReadChannel(PORTC_ID, PIN_C_2) == STD_HIGH);
+
+	Dio_WriteChannel(PORTC_ID, PIN0_ID, STD_HIGH);
+	Dio_WriteChannel(PORTC_ID, PIN1_ID, STD_HIGH);
+	Dio_HostTestCommit();
+	HOST_TEST_CHECK(PORTC == 0x07U);
+
+	/* Inputs read the external level, writes to PINx are ignored */
+	Dio_HostSetInputs(PORTD_ID, 0x20U);
+	HOST_TEST_CHECK(Dio_ReadChannel(PORTD_ID, PIN5_ID) == STD_HIGH);
+	HOST_TEST_CHECK(Dio_ReadChannel(PORTD_ID, PIN_D_4) == STD_LOW);
+	Dio_HostWrite(&PIND, 0xFFU);
+	HOST_TEST_CHECK(Dio_ReadChannel(PORTD_ID, PIN_D_4) == STD_LOW);
+	Dio_HostSetInputs(PORTD_ID, 0x00U);
+
+	/* Direction of a single channel */
+	Dio_SetupChannelDirection(PORTC_ID, PIN7_ID, OUTPUT);
+	HOST_TEST_CHECK(DDRC == 0x87U);
+	Dio_SetupChannelDirection(PORTC_ID, PIN_C_7, INPUT);
+	HOST_TEST_CHECK(DDRC == 0x07U);
+
+	/* Channel IDs out of the device */
+	Dio_WriteChannel(PORTC_ID, DIO_CONFIGURED_CHANNLES, STD_LOW);
+	HOST_TEST_CHECK_DET(DIO_E_PARAM_INVALID_CHANNEL_ID);
+	(void)Dio_ReadChannel(PORTC_ID, DIO_CONFIGURED_CHANNLES);
+	HOST_TEST_CHECK_DET(DIO_E_PARAM_INVALID_CHANNEL_ID);
+	Dio_SetupChannelDirection(PORTC_ID, DIO_CONFIGURED_CHANNLES, OUTPUT);
+	HOST_TEST_CHECK_DET(DIO_E_PARAM_INVALID_CHANNEL_ID);
+	Dio_HostTestCommit();
+	HOST_TEST_CHECK(PORTC == 0x07U);
+	HOST_TEST_CHECK(DDRC == 0x07U);
+}
+
+void Dio_HostTestPorts(void) {
+	Dio_WritePort(PORTB_ID, 0x5AU);
+	Dio_HostTestCommit();
+	HOST_TEST_CHECK(PORTB == 0x5AU);
+	HOST_TEST_CHECK(Dio_ReadPort(PORTB_ID) == 0x5AU);
+
+	Dio_HostSetInputs(PORTD_ID, 0xA5U);
+	HOST_TEST_CHECK(Dio_ReadPort(PORTD_ID) == 0xA5U);
+	Dio_HostSetInputs(PORTD_ID, 0x00U);
+
+	Dio_WritePort(PORTB_ID, 0x00U);
+	Dio_HostTestCommit();
+	HOST_TEST_CHECK(PORTB == 0x00U);
+
+	/* Port IDs out of the device */
+	Dio_WritePort((Dio_PortType)(PORTA_ID + DIO_CONFIGURED_PORTS), 0xFFU);
+	HOST_TEST_CHECK_DET(DIO_E_PARAM_INVALID_PORT_ID);
+	(void)Dio_ReadPort((Dio_PortType)(PORTA_ID + DIO_CONFIGURED_PORTS));
+	HOST_TEST_CHECK_DET(DIO_E_PARAM_INVALID_PORT_ID);
+}
+
+void Dio_HostTestVersionInfo(void) {
+	Std_VersionInfoType VersionInfo;
+
+	Dio_GetVersionInfo(&VersionInfo);
+	HOST_TEST_CHECK(VersionInfo.vendorID == DIO_VENDOR_ID);
+	HOST_TEST_CHECK(VersionInfo.moduleID == DIO_MODULE_ID);
+	HOST_TEST_CHECK(VersionInfo.sw_major_version == DIO_SW_MAJOR_VERSION);
+
+	Dio_GetVersionInfo(NULL_PTR);
+	HOST_TEST_CHECK_DET(DIO_E_PARAM_POINTER);
+}
+
+/* =====================================================================================================
+ * 											  MAIN
+ * =====================================================================================================*/
+int main(void) {
+	Dio_HostReset();
+	Det_Init();
+
+	Dio_HostTestInit();
+	Dio_HostTestChannels();
+	Dio_HostTestFlip();
+	Dio_HostTestFast();
+	Dio_HostTestPorts();
+	Dio_HostTestMaskedWrite();
+	Dio_HostTestGroups();
+	Dio_HostTestChannels32();
+	Dio_HostTestCpp();
+	Dio_HostTestSampling();
+	Dio_HostTestDebounce();
+	Dio_HostTestNotify();
+	Dio_HostTestPwm();
+	Dio_HostTestPattern();
+	Dio_HostTestDeferred();
+	Dio_HostTestTrace();
+	Dio_HostTestProfiling();
+	Dio_HostTestDet();
+	Dio_HostTestVcd();
+	Dio_HostTestVersionInfo();
+	Dio_HostTestDevices();
+	Dio_HostTestPortDirection();
+
+	printf("Dio_HostTest: %lu checks, %lu failed\n", (unsigned long)Dio_HostTestChecks, (unsigned long)Dio_HostTestFailures);
+	return (0U == Dio_HostTestFailures) ? 0 : 1;
+}
@@ -0,0 +1,112 @@
+/*======================================================================================================
+ * Module: DIO																							*
+ * File Name: Dio_HostTest.h																			*
+ * Description: Checks and helpers shared by the host test suites of the DIO Driver						*
+ * Author: Mahmoud-Helmy																				*
+ *======================================================================================================*/
+/* =====================================================================================================
+ * 											 FILE GUARD
+ * =====================================================================================================*/
+#ifndef DIO_HOST_TEST_H
+#define DIO_HOST_TEST_H
+
+/* =====================================================================================================
+ * 											INCLUDES
+ * =====================================================================================================*/
+#include <stdio.h>
+
+#include "Dio_Host.h"
+#include "../Dio/Dio.h"
+#include "../Dio/MemMap.h"
+#include "../Det/Det.h"
+
+#if !defined(DIO_HOST_BACKEND)
+  #error "The host tests are only part of the host build (DIO_HOST_BACKEND)"
+#endif
+
+/* The checks expect the channels of the test descriptions (Dio_HostTest*.json) */
+#if !defined(DIO_CHANNEL_KEY_D0) || !defined(DIO_GROUP_SEGMENTS)
+  #error "The host tests shall be built with the configuration generated from Dio_HostTest*.json"
+#endif
+
+/* The suites are also written in C++ (Dio_HostTestCpp.cpp) */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* =====================================================================================================
+ * 										   DEFINITIONS
+ * =====================================================================================================*/
+/* Counts a check and reports it with its line if it fails, the run goes on with the next check */
+#define HOST_TEST_CHECK(COND) \
+	do { \
+		++Dio_HostTestChecks; \
+		if (!(COND)) { \
+			++Dio_HostTestFailures; \
+			printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #COND); \
+		} else { \
+			/* Do Nothing */ \
+		} \
+	} while (0)
+
+/* Checks the last development error reported since the previous HOST_TEST_CHECK_DET */
+#define HOST_TEST_CHECK_DET(ERROR_ID) \
+	do { \
+		HOST_TEST_CHECK(Det_ErrorId == (ERROR_ID)); \
+		Det_ErrorId = 0U; \
+	} while (0)
+
+/* Bit of a global channel ID in a Dio_ChannelsLevelType */
+#define HOST_TEST_CHANNEL(CHANNEL)     ((Dio_ChannelsLevelType)1U << (CHANNEL))
+
+/* =====================================================================================================
+ *                                      EXTERNAL VARIABLES
+ * =====================================================================================================*/
+extern uint32 Dio_HostTestChecks;
+extern uint32 Dio_HostTestFailures;
+
+/* Registers of each port of the device, indexed by (Port_Id - PORTA_ID) */
+extern volatile uint8 * const Dio_HostTestPort[DIO_CONFIGURED_PORTS];
+extern volatile uint8 * const Dio_HostTestDdr[DIO_CONFIGURED_PORTS];
+
+/* =====================================================================================================
+ * 							            FUNCTION PROTOTYPES
+ * =====================================================================================================*/
+/* Makes the outputs written so far visible in the PORT registers */
+void Dio_HostTestCommit(void);
+
+#if (DIO_DEBOUNCE_API == STD_ON) || (DIO_NOTIFICATION_API == STD_ON)
+/* Calls Dio_MainFunction Count times */
+void Dio_HostTestMainFunction(uint8 Count);
+#endif
+
+/* Test suites, run in this order by main (Dio_HostTest.c). Each one leaves the registers as
+ * Dio_Init set them and the external pin levels at 0x00 for the next one. */
+void Dio_HostTestInit(void);
+void Dio_HostTestChannels(void);
+void Dio_HostTestFlip(void);
+void Dio_HostTestFast(void);
+void Dio_HostTestPorts(void);
+void Dio_HostTestMaskedWrite(void);
+void Dio_HostTestGroups(void);
+void Dio_HostTestChannels32(void);
+void Dio_HostTestCpp(void);
+void Dio_HostTestSampling(void);
+void Dio_HostTestDebounce(void);
+void Dio_HostTestNotify(void);
+void Dio_HostTestPwm(void);
+void Dio_HostTestPattern(void);
+void Dio_HostTestDeferred(void);
+void Dio_HostTestTrace(void);
+void Dio_HostTestProfiling(void);
+void Dio_HostTestDet(void);
+void Dio_HostTestVcd(void);
+void Dio_HostTestVersionInfo(void);
+void Dio_HostTestDevices(void);
+void Dio_HostTestPortDirection(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DIO_HOST_TEST_H */
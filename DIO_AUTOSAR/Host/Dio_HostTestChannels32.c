@@ -0,0 +1,37 @@
+/*======================================================================================================
+ * Module: DIO																							*
+ * File Name: Dio_HostTestChannels32.c																	*
+ * Description: Host test of the whole device channel APIs (Dio_*Channels32)							*
+ * Author: Mahmoud-Helmy																				*
+ *======================================================================================================*/
+/* =====================================================================================================
+ * 											   INCLUDES
+ * =====================================================================================================*/
+#include "Dio_HostTest.h"
+
+/* =====================================================================================================
+ * 											 TESTS
+ * =====================================================================================================*/
+void Dio_HostTestChannels32(void) {
+	Dio_ChannelsLevelType Levels;
+
+	/* PIN_A_1 and PIN_B_0 set, PIN_C_1 cleared, with one write per port */
+	Dio_WriteChannels32(HOST_TEST_CHANNEL(PIN_A_1) | HOST_TEST_CHANNEL(PIN_B_0) | HOST_TEST_CHANNEL(PIN_C_1),
+			HOST_TEST_CHANNEL(PIN_A_1) | HOST_TEST_CHANNEL(PIN_B_0));
+	Dio_HostTestCommit();
+	HOST_TEST_CHECK(PORTA == 0x03U);
+	HOST_TEST_CHECK(PORTB == 0x01U);
+	HOST_TEST_CHECK(PORTC == 0x05U);
+
+	/* Outputs read back their latch, inputs the external level */
+	Dio_HostSetInputs(PORTD_ID, 0x90U);
+	Levels = Dio_ReadChannels32();
+	HOST_TEST_CHECK(Levels == 0x90050103UL);
+	Dio_HostSetInputs(PORTD_ID, 0x00U);
+
+	Dio_FlipChannels32(HOST_TEST_CHANNEL(PIN_A_1) | HOST_TEST_CHANNEL(PIN_B_0) | HOST_TEST_CHANNEL(PIN_C_1));
+	Dio_HostTestCommit();
+	HOST_TEST_CHECK(PORTA == 0x01U);
+	HOST_TEST_CHECK(PORTB == 0x00U);
+	HOST_TEST_CHECK(PORTC == 0x07U);
+}
@@ -0,0 +1,82 @@
+/*======================================================================================================
+ * Module: DIO																							*
+ * File Name: Dio_HostTestCpp.cpp																		*
+ * Description: Host test of the C++ template layer (Dio.hpp)											*
+ * Author: Mahmoud-Helmy																				*
+ *======================================================================================================*/
+/* =====================================================================================================
+ * 											   INCLUDES
+ * =====================================================================================================*/
+#include "Dio_HostTest.h"
+
+/* =====================================================================================================
+ * 											 TESTS
+ * =====================================================================================================*/
+#if (DIO_DEFERRED_WRITE == STD_OFF)
+/* The C++ template layer on the channels of Dio_HostTest.json */
+#include "../Dio/Dio.hpp"
+
+typedef Dio::Pin<PORTC_ID, PIN_C_2> Led2;
+typedef Dio::Pin<PORTC_ID, PIN7_ID> SpareC7;
+typedef Dio::Pin<PORTD_ID, PIN5_ID> SenseD5;
+typedef Dio::Port<PORTB_ID> PatternPort;
+typedef Dio::Port<PORTD_ID> InputPort;
+typedef Dio::PinGroup<PORTA_ID, 0x0EU, 1U> Segments;
+typedef Dio::PinGroup<PORTD_ID, 0xF0U, 4U> SenseNibble;
+#endif
+
+void Dio_HostTestCpp(void) {
+#if (DIO_DEFERRED_WRITE == STD_OFF)
+	/* Single pins: the other pins of the port keep their level */
+	Led2::Clear();
+	HOST_TEST_CHECK(PORTC == 0x03U);
+	HOST_TEST_CHECK(Led2::Read() == STD_LOW);
+	Led2::Set();
+	HOST_TEST_CHECK(PORTC == 0x07U);
+	HOST_TEST_CHECK(Led2::Toggle() == STD_LOW);
+	HOST_TEST_CHECK(PORTC == 0x03U);
+	Led2::Write(STD_HIGH);
+	HOST_TEST_CHECK(PORTC == 0x07U);
+	HOST_TEST_CHECK(Led2::Channel == PIN_C_2);
+
+	SpareC7::SetOutput();
+	HOST_TEST_CHECK(DDRC == 0x87U);
+	SpareC7::SetInput();
+	HOST_TEST_CHECK(DDRC == 0x07U);
+
+	/* Init applies the configuration of Dio_ConfigurationSet */
+	Led2::Clear();
+	Led2::Init();
+	HOST_TEST_CHECK(PORTC == 0x07U);
+	HOST_TEST_CHECK(DDRC == 0x07U);
+
+	/* Inputs read the external level through the host backend */
+	Dio_HostSetInputs(PORTD_ID, 0x20U);
+	HOST_TEST_CHECK(SenseD5::Read() == STD_HIGH);
+	HOST_TEST_CHECK(InputPort::Read() == 0x20U);
+	HOST_TEST_CHECK(SenseNibble::Read() == 0x02U);
+	Dio_HostSetInputs(PORTD_ID, 0x00U);
+	HOST_TEST_CHECK(SenseD5::Read() == STD_LOW);
+
+	/* Whole and masked port writes */
+	PatternPort::Write(0x5AU);
+	HOST_TEST_CHECK(PORTB == 0x5AU);
+	PatternPort::Write(0xF0U, 0x3CU);
+	HOST_TEST_CHECK(PORTB == 0x72U);
+	HOST_TEST_CHECK(PatternPort::Read() == 0x72U);
+	PatternPort::Write(0x00U);
+	HOST_TEST_CHECK(PORTB == 0x00U);
+	PatternPort::SetDirection(0x0FU);
+	HOST_TEST_CHECK(DDRB == 0x0FU);
+	PatternPort::SetDirection(0xFFU);
+	HOST_TEST_CHECK(DDRB == 0xFFU);
+
+	/* Group: single read-modify-write, same result as the C descriptor */
+	Segments::Write(0x05U);
+	HOST_TEST_CHECK(PORTA == 0x0BU);
+	HOST_TEST_CHECK(Segments::Read() == 0x05U);
+	HOST_TEST_CHECK(Dio_ReadChannelGroup(&Segments::Descriptor) == 0x05U);
+	Dio_WriteChannelGroup(&Segments::Descriptor, 0x00U);
+	HOST_TEST_CHECK(PORTA == 0x01U);
+#endif
+}
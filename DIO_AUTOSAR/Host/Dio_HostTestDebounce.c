@@ -0,0 +1,40 @@
+/*======================================================================================================
+ * Module: DIO																							*
+ * File Name: Dio_HostTestDebounce.c																	*
+ * Description: Host test of the debounced inputs (Dio_MainFunction)									*
+ * Author: Mahmoud-Helmy																				*
+ *======================================================================================================*/
+/* =====================================================================================================
+ * 											   INCLUDES
+ * =====================================================================================================*/
+#include "Dio_HostTest.h"
+
+/* =====================================================================================================
+ * 											 TESTS
+ * =====================================================================================================*/
+void Dio_HostTestDebounce(void) {
+#if (DIO_DEBOUNCE_API == STD_ON)
+	/* A new level is taken after DIO_DEBOUNCE_SAMPLES consecutive samples */
+	Dio_HostSetInputs(PORTD_ID, 0x10U);
+	Dio_HostTestMainFunction((uint8)(DIO_DEBOUNCE_SAMPLES - 1U));
+	HOST_TEST_CHECK(Dio_ReadDebouncedChannel(PIN_D_4) == STD_LOW);
+	Dio_HostTestMainFunction(1U);
+	HOST_TEST_CHECK(Dio_ReadDebouncedChannel(PIN_D_4) == STD_HIGH);
+	HOST_TEST_CHECK((Dio_ReadDebouncedChannels32() >> PIN_D_0) == 0x10UL);
+
+	/* A shorter glitch is filtered out and restarts the count */
+	Dio_HostSetInputs(PORTD_ID, 0x00U);
+	Dio_HostTestMainFunction((uint8)(DIO_DEBOUNCE_SAMPLES - 1U));
+	Dio_HostSetInputs(PORTD_ID, 0x10U);
+	Dio_HostTestMainFunction(1U);
+	Dio_HostSetInputs(PORTD_ID, 0x00U);
+	Dio_HostTestMainFunction((uint8)(DIO_DEBOUNCE_SAMPLES - 1U));
+	HOST_TEST_CHECK(Dio_ReadDebouncedChannel(PIN_D_4) == STD_HIGH);
+	Dio_HostTestMainFunction(1U);
+	HOST_TEST_CHECK(Dio_ReadDebouncedChannel(PIN_D_4) == STD_LOW);
+	HOST_TEST_CHECK(Dio_ReadDebouncedChannels32() == 0x00070001UL);
+
+	(void)Dio_ReadDebouncedChannel(DIO_IMAGE_CHANNELS);
+	HOST_TEST_CHECK_DET(DIO_E_PARAM_INVALID_CHANNEL_ID);
+#endif
+}
@@ -0,0 +1,37 @@
+/*======================================================================================================
+ * Module: DIO																							*
+ * File Name: Dio_HostTestDeferred.c																	*
+ * Description: Host test of the output shadows (Dio_CommitOutputs)										*
+ * Author: Mahmoud-Helmy																				*
+ *======================================================================================================*/
+/* =====================================================================================================
+ * 											   INCLUDES
+ * =====================================================================================================*/
+#include "Dio_HostTest.h"
+
+/* =====================================================================================================
+ * 											 TESTS
+ * =====================================================================================================*/
+void Dio_HostTestDeferred(void) {
+#if (DIO_DEFERRED_WRITE == STD_ON)
+	/* The outputs change together at the commit, the reads see the registers */
+	Dio_WriteChannel(PORTC_ID, PIN0_ID, STD_LOW);
+	HOST_TEST_CHECK(Dio_FlipChannel(PORTC_ID, PIN1_ID) == STD_LOW);
+	Dio_WritePort(PORTB_ID, 0x3CU);
+	HOST_TEST_CHECK(PORTC == 0x07U);
+	HOST_TEST_CHECK(PORTB == 0x00U);
+	HOST_TEST_CHECK(Dio_ReadChannel(PORTC_ID, PIN0_ID) == STD_HIGH);
+	Dio_CommitOutputs();
+	HOST_TEST_CHECK(PORTC == 0x04U);
+	HOST_TEST_CHECK(PORTB == 0x3CU);
+
+	/* Successive writes before a commit: the last level wins */
+	Dio_WriteChannels32(HOST_TEST_CHANNEL(PIN_C_0) | HOST_TEST_CHANNEL(PIN_C_1) | HOST_TEST_CHANNEL(PIN_B_2),
+			HOST_TEST_CHANNEL(PIN_C_0) | HOST_TEST_CHANNEL(PIN_C_1));
+	Dio_WritePort(PORTB_ID, 0xFFU);
+	Dio_WritePort(PORTB_ID, 0x00U);
+	Dio_CommitOutputs();
+	HOST_TEST_CHECK(PORTC == 0x07U);
+	HOST_TEST_CHECK(PORTB == 0x00U);
+#endif
+}
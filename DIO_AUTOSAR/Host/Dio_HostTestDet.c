@@ -0,0 +1,47 @@
+/*======================================================================================================
+ * Module: DIO																							*
+ * File Name: Dio_HostTestDet.c																			*
+ * Description: Host test of the DET error ring and counters											*
+ * Author: Mahmoud-Helmy																				*
+ *======================================================================================================*/
+/* =====================================================================================================
+ * 											   INCLUDES
+ * =====================================================================================================*/
+#include "Dio_HostTest.h"
+
+/* =====================================================================================================
+ * 											 TESTS
+ * =====================================================================================================*/
+void Dio_HostTestDet(void) {
+	Det_ErrorRecordType Record;
+
+	/* Errors of the DIO services, newest first in the ring */
+	Det_Init();
+	Dio_WritePort((Dio_PortType)(PORTA_ID + DIO_CONFIGURED_PORTS), 0xFFU);
+	(void)Dio_ReadChannel(PORTC_ID, DIO_CONFIGURED_CHANNLES);
+	(void)Dio_ReadChannel(PORTC_ID, DIO_CONFIGURED_CHANNLES);
+	HOST_TEST_CHECK(Det_GetErrorRecord(0U, &Record) == E_OK);
+	HOST_TEST_CHECK(Record.ModuleId == DIO_MODULE_ID);
+	HOST_TEST_CHECK(Record.ApiId == DIO_READ_CHANNEL_SID);
+	HOST_TEST_CHECK(Record.ErrorId == DIO_E_PARAM_INVALID_CHANNEL_ID);
+	HOST_TEST_CHECK(Det_GetErrorRecord(2U, &Record) == E_OK);
+	HOST_TEST_CHECK(Record.ApiId == DIO_WRITE_PORT_SID);
+	HOST_TEST_CHECK(Record.ErrorId == DIO_E_PARAM_INVALID_PORT_ID);
+	HOST_TEST_CHECK(Det_GetErrorRecord(3U, &Record) == E_NOT_OK);
+
+	/* Counted by Det_MainFunction only */
+	HOST_TEST_CHECK(Det_GetErrorCount(DIO_MODULE_ID, DIO_READ_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID) == 0U);
+	Det_MainFunction();
+	HOST_TEST_CHECK(Det_GetErrorCount(DIO_MODULE_ID, DIO_READ_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID) == 2U);
+	HOST_TEST_CHECK(Det_GetErrorCount(DIO_MODULE_ID, DIO_WRITE_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID) == 1U);
+
+	/* Unprocessed records are kept, the errors reported on a full ring are only counted as lost */
+	for (uint8 Error = 0U; Error < (DET_RING_SIZE + 2U); ++Error) {
+		(void)Dio_ReadPort((Dio_PortType)(PORTA_ID + DIO_CONFIGURED_PORTS));
+	}
+	HOST_TEST_CHECK(Det_LostErrors == 2U);
+	Det_MainFunction();
+	HOST_TEST_CHECK(Det_GetErrorCount(DIO_MODULE_ID, DIO_READ_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID) == DET_RING_SIZE);
+
+	Det_Init();
+}
@@ -0,0 +1,64 @@
+/*======================================================================================================
+ * Module: DIO																							*
+ * File Name: Dio_HostTestDevices.c																		*
+ * Description: Host test of the ports of the larger devices (ATmega128 / ATmega2560)					*
+ * Author: Mahmoud-Helmy																				*
+ *======================================================================================================*/
+/* =====================================================================================================
+ * 											   INCLUDES
+ * =====================================================================================================*/
+#include "Dio_HostTest.h"
+
+/* =====================================================================================================
+ * 											 TESTS
+ * =====================================================================================================*/
+/* Pins that are not bonded out are rejected by the development error checks, the ports of
+ * the larger devices are reached through the same tables as PORTA .. PORTD */
+void Dio_HostTestDevices(void) {
+#if (DIO_DEVICE == DIO_DEVICE_ATMEGA128)
+	Dio_WriteChannel(PORTG_ID, PIN4_ID, STD_HIGH);
+	HOST_TEST_CHECK_DET(0U);
+	Dio_HostTestCommit();
+	HOST_TEST_CHECK(PORTG == 0x10U);
+	Dio_WriteChannel(PORTG_ID, PIN5_ID, STD_HIGH);
+	HOST_TEST_CHECK_DET(DIO_E_PARAM_INVALID_CHANNEL_ID);
+	(void)Dio_ReadChannel(PORTG_ID, PIN_G_7);
+	HOST_TEST_CHECK_DET(DIO_E_PARAM_INVALID_CHANNEL_ID);
+	Dio_HostTestCommit();
+	HOST_TEST_CHECK(PORTG == 0x10U);
+
+	Dio_WriteChannel(PORTG_ID, PIN4_ID, STD_LOW);
+	Dio_HostTestCommit();
+	HOST_TEST_CHECK(PORTG == 0x00U);
+#elif (DIO_DEVICE == DIO_DEVICE_ATMEGA2560)
+	Dio_WriteChannel(PORTG_ID, PIN5_ID, STD_HIGH);
+	HOST_TEST_CHECK_DET(0U);
+	Dio_HostTestCommit();
+	HOST_TEST_CHECK(PORTG == 0x20U);
+	Dio_WriteChannel(PORTG_ID, PIN6_ID, STD_HIGH);
+	HOST_TEST_CHECK_DET(DIO_E_PARAM_INVALID_CHANNEL_ID);
+	(void)Dio_FlipChannel(PORTG_ID, PIN_G_7);
+	HOST_TEST_CHECK_DET(DIO_E_PARAM_INVALID_CHANNEL_ID);
+	Dio_SetupChannelDirection(PORTG_ID, PIN6_ID, OUTPUT);
+	HOST_TEST_CHECK_DET(DIO_E_PARAM_INVALID_CHANNEL_ID);
+	Dio_HostTestCommit();
+	HOST_TEST_CHECK(PORTG == 0x20U);
+	HOST_TEST_CHECK(DDRG == 0x00U);
+
+	Dio_WriteChannel(PORTG_ID, PIN5_ID, STD_LOW);
+	Dio_HostTestCommit();
+	HOST_TEST_CHECK(PORTG == 0x00U);
+
+	/* PORTL, last port and in the extended I/O space */
+	Dio_WriteChannel(PORTL_ID, PIN_L_7, STD_HIGH);
+	Dio_HostTestCommit();
+	HOST_TEST_CHECK_DET(0U);
+	HOST_TEST_CHECK(PORTL == 0x80U);
+	HOST_TEST_CHECK(Dio_FlipChannel(PORTL_ID, PIN7_ID) == STD_LOW);
+	Dio_HostTestCommit();
+	HOST_TEST_CHECK(PORTL == 0x00U);
+	Dio_HostSetInputs(PORTL_ID, 0x81U);
+	HOST_TEST_CHECK(Dio_ReadPort(PORTL_ID) == 0x81U);
+	Dio_HostSetInputs(PORTL_ID, 0x00U);
+#endif
+}
@@ -0,0 +1,46 @@
+/*======================================================================================================
+ * Module: DIO																							*
+ * File Name: Dio_HostTestFast.c																		*
+ * Description: Host test of the inline fast paths (Dio_*ChannelFast)									*
+ * Author: Mahmoud-Helmy																				*
+ *======================================================================================================*/
+/* =====================================================================================================
+ * 											   INCLUDES
+ * =====================================================================================================*/
+#include "Dio_HostTest.h"
+
+/* =====================================================================================================
+ * 											 TESTS
+ * =====================================================================================================*/
+void Dio_HostTestFast(void) {
+#if (DIO_INLINE_API == STD_ON)
+	/* Constant arguments: the fast paths, same result as the APIs */
+	Dio_WriteChannelFast(PORTC_ID, PIN2_ID, STD_LOW);
+	Dio_HostTestCommit();
+	HOST_TEST_CHECK(PORTC == 0x03U);
+	HOST_TEST_CHECK(Dio_ReadChannelFast(PORTC_ID, PIN2_ID) == STD_LOW);
+	Dio_WriteChannelFast(PORTC_ID, PIN_C_2, STD_HIGH);
+	Dio_HostTestCommit();
+	HOST_TEST_CHECK(PORTC == 0x07U);
+	HOST_TEST_CHECK(Dio_ReadChannelFast(PORTC_ID, PIN2_ID) == STD_HIGH);
+
+	HOST_TEST_CHECK(Dio_FlipChannelFast(PORTC_ID, PIN1_ID) == STD_LOW);
+	Dio_HostTestCommit();
+	HOST_TEST_CHECK(PORTC == 0x05U);
+	HOST_TEST_CHECK(Dio_FlipChannelFast(PORTC_ID, PIN1_ID) == STD_HIGH);
+	Dio_HostTestCommit();
+	HOST_TEST_CHECK(PORTC == 0x07U);
+
+	/* Inputs read the external level */
+	Dio_HostSetInputs(PORTD_ID, 0x40U);
+	HOST_TEST_CHECK(Dio_ReadChannelFast(PORTD_ID, PIN6_ID) == STD_HIGH);
+	HOST_TEST_CHECK(Dio_ReadChannelFast(PORTD_ID, PIN7_ID) == STD_LOW);
+	Dio_HostSetInputs(PORTD_ID, 0x00U);
+
+	/* Arguments out of the device fall back to the APIs and their checks */
+	Dio_WriteChannelFast(PORTC_ID, DIO_CONFIGURED_CHANNLES, STD_LOW);
+	HOST_TEST_CHECK_DET(DIO_E_PARAM_INVALID_CHANNEL_ID);
+	Dio_HostTestCommit();
+	HOST_TEST_CHECK(PORTC == 0x07U);
+#endif
+}
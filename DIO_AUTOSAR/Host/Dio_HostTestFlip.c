@@ -0,0 +1,36 @@
+/*======================================================================================================
+ * Module: DIO																							*
+ * File Name: Dio_HostTestFlip.c																		*
+ * Description: Host test of Dio_FlipChannel															*
+ * Author: Mahmoud-Helmy																				*
+ *======================================================================================================*/
+/* =====================================================================================================
+ * 											   INCLUDES
+ * =====================================================================================================*/
+#include "Dio_HostTest.h"
+
+/* =====================================================================================================
+ * 											 TESTS
+ * =====================================================================================================*/
+void Dio_HostTestFlip(void) {
+	/* The level after the flip is returned */
+	HOST_TEST_CHECK(Dio_FlipChannel(PORTC_ID, PIN0_ID) == STD_LOW);
+	Dio_HostTestCommit();
+	HOST_TEST_CHECK(PORTC == 0x06U);
+	HOST_TEST_CHECK(Dio_FlipChannel(PORTC_ID, PIN_C_0) == STD_HIGH);
+	Dio_HostTestCommit();
+	HOST_TEST_CHECK(PORTC == 0x07U);
+
+	/* The other channels of the port keep their level */
+	HOST_TEST_CHECK(Dio_FlipChannel(PORTC_ID, PIN_C_2) == STD_LOW);
+	Dio_HostTestCommit();
+	HOST_TEST_CHECK(PORTC == 0x03U);
+	HOST_TEST_CHECK(Dio_FlipChannel(PORTC_ID, PIN2_ID) == STD_HIGH);
+	Dio_HostTestCommit();
+	HOST_TEST_CHECK(PORTC == 0x07U);
+
+	(void)Dio_FlipChannel(PORTC_ID, DIO_CONFIGURED_CHANNLES);
+	HOST_TEST_CHECK_DET(DIO_E_PARAM_INVALID_CHANNEL_ID);
+	Dio_HostTestCommit();
+	HOST_TEST_CHECK(PORTC == 0x07U);
+}
@@ -0,0 +1,40 @@
+/*======================================================================================================
+ * Module: DIO																							*
+ * File Name: Dio_HostTestGroups.c																		*
+ * Description: Host test of the channel group APIs (Dio_ReadChannelGroup / Dio_WriteChannelGroup)		*
+ * Author: Mahmoud-Helmy																				*
+ *======================================================================================================*/
+/* =====================================================================================================
+ * 											   INCLUDES
+ * =====================================================================================================*/
+#include "Dio_HostTest.h"
+
+/* =====================================================================================================
+ * 											 TESTS
+ * =====================================================================================================*/
+void Dio_HostTestGroups(void) {
+	/* SEGMENTS: PIN_A_1 .. PIN_A_3, the other pins of PORTA keep their level */
+	Dio_WriteChannelGroup(DIO_GROUP_SEGMENTS, 0x05U);
+	Dio_HostTestCommit();
+	HOST_TEST_CHECK(PORTA == 0x0BU);
+	HOST_TEST_CHECK(Dio_ReadChannelGroup(DIO_GROUP_SEGMENTS) == 0x05U);
+
+	/* Bits above the group are dropped */
+	Dio_WriteChannelGroup(DIO_GROUP_SEGMENTS, 0xF2U);
+	Dio_HostTestCommit();
+	HOST_TEST_CHECK(PORTA == 0x05U);
+
+	Dio_WriteChannelGroup(DIO_GROUP_SEGMENTS, 0x00U);
+	Dio_HostTestCommit();
+	HOST_TEST_CHECK(PORTA == 0x01U);
+
+	/* SENSE_NIBBLE: inputs PIN_D_4 .. PIN_D_7, shifted down to bit 0 */
+	Dio_HostSetInputs(PORTD_ID, 0xA3U);
+	HOST_TEST_CHECK(Dio_ReadChannelGroup(DIO_GROUP_SENSE_NIBBLE) == 0x0AU);
+	Dio_HostSetInputs(PORTD_ID, 0x00U);
+
+	(void)Dio_ReadChannelGroup(NULL_PTR);
+	HOST_TEST_CHECK_DET(DIO_E_PARAM_INVALID_GROUP);
+	Dio_WriteChannelGroup(NULL_PTR, 0x00U);
+	HOST_TEST_CHECK_DET(DIO_E_PARAM_INVALID_GROUP);
+}
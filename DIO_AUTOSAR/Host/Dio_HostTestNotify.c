@@ -0,0 +1,72 @@
+/*======================================================================================================
+ * Module: DIO																							*
+ * File Name: Dio_HostTestNotify.c																		*
+ * Description: Host test of the edge notifications (Dio_MainFunction)									*
+ * Author: Mahmoud-Helmy																				*
+ *======================================================================================================*/
+/* =====================================================================================================
+ * 											   INCLUDES
+ * =====================================================================================================*/
+#include "Dio_HostTest.h"
+
+/* =====================================================================================================
+ * 											 TESTS
+ * =====================================================================================================*/
+#if (DIO_NOTIFICATION_API == STD_ON)
+/* Notifications recorded by Dio_HostTestNotification */
+#define HOST_TEST_MAX_NOTIFICATIONS    (8U)
+
+typedef struct Dio_HostTestNotificationType {
+	Dio_ChannelType Channel;
+	Dio_LevelType Level;
+} Dio_HostTestNotificationType;
+
+STATIC Dio_HostTestNotificationType Dio_HostTestNotifications[HOST_TEST_MAX_NOTIFICATIONS];
+STATIC uint8 Dio_HostTestNotificationCount = 0U;
+
+/* Edge notification of KEY_D0 .. KEY_D2 (Dio_HostTest.json) */
+void Dio_HostTestNotification(Dio_ChannelType Channel_Id, Dio_LevelType Level);
+
+void Dio_HostTestNotification(Dio_ChannelType Channel_Id, Dio_LevelType Level) {
+	if (Dio_HostTestNotificationCount < HOST_TEST_MAX_NOTIFICATIONS) {
+		Dio_HostTestNotifications[Dio_HostTestNotificationCount].Channel = Channel_Id;
+		Dio_HostTestNotifications[Dio_HostTestNotificationCount].Level = Level;
+	} else {
+		/* Do Nothing */
+	}
+	Dio_HostTestNotificationCount++;
+}
+#endif
+
+void Dio_HostTestNotify(void) {
+#if (DIO_NOTIFICATION_API == STD_ON)
+	/* KEY_D0 rising, KEY_D1 falling, KEY_D2 both edges: only D0 and D2 rise */
+	Dio_HostTestNotificationCount = 0U;
+	Dio_HostSetInputs(PORTD_ID, 0x07U);
+	Dio_HostTestMainFunction(DIO_DEBOUNCE_SAMPLES);
+	HOST_TEST_CHECK(Dio_HostTestNotificationCount == 2U);
+	HOST_TEST_CHECK(Dio_HostTestNotifications[0].Channel == PIN_D_0);
+	HOST_TEST_CHECK(Dio_HostTestNotifications[0].Level == STD_HIGH);
+	HOST_TEST_CHECK(Dio_HostTestNotifications[1].Channel == PIN_D_2);
+	HOST_TEST_CHECK(Dio_HostTestNotifications[1].Level == STD_HIGH);
+
+	/* No new edge, no notification */
+	Dio_HostTestMainFunction(DIO_DEBOUNCE_SAMPLES);
+	HOST_TEST_CHECK(Dio_HostTestNotificationCount == 2U);
+
+	/* Channels without a callback are not notified */
+	Dio_HostSetInputs(PORTD_ID, 0x17U);
+	Dio_HostTestMainFunction(DIO_DEBOUNCE_SAMPLES);
+	HOST_TEST_CHECK(Dio_HostTestNotificationCount == 2U);
+
+	/* Only D1 and D2 fall */
+	Dio_HostTestNotificationCount = 0U;
+	Dio_HostSetInputs(PORTD_ID, 0x00U);
+	Dio_HostTestMainFunction(DIO_DEBOUNCE_SAMPLES);
+	HOST_TEST_CHECK(Dio_HostTestNotificationCount == 2U);
+	HOST_TEST_CHECK(Dio_HostTestNotifications[0].Channel == PIN_D_1);
+	HOST_TEST_CHECK(Dio_HostTestNotifications[0].Level == STD_LOW);
+	HOST_TEST_CHECK(Dio_HostTestNotifications[1].Channel == PIN_D_2);
+	HOST_TEST_CHECK(Dio_HostTestNotifications[1].Level == STD_LOW);
+#endif
+}
@@ -0,0 +1,71 @@
+/*======================================================================================================
+ * Module: DIO																							*
+ * File Name: Dio_HostTestPattern.c																		*
+ * Description: Host test of the pattern player (Dio_Pattern.c)											*
+ * Author: Mahmoud-Helmy																				*
+ *======================================================================================================*/
+/* =====================================================================================================
+ * 											   INCLUDES
+ * =====================================================================================================*/
+#include "Dio_HostTest.h"
+
+#if (DIO_PATTERN_API == STD_ON)
+#include "../Dio/Dio_Pattern.h"
+#endif
+
+/* =====================================================================================================
+ * 											 TESTS
+ * =====================================================================================================*/
+void Dio_HostTestPattern(void) {
+#if (DIO_PATTERN_API == STD_ON)
+	static const FLASH uint8 OneShot[3] = { 0x11U, 0x22U, 0x33U };
+	static const FLASH uint8 First[2] = { 0xA0U, 0xA1U };
+	static const FLASH uint8 Second[2] = { 0xB0U, 0xB1U };
+	static const uint8 OneShotPort[6] = { 0x11U, 0x11U, 0x22U, 0x22U, 0x33U, 0x33U };
+
+	/* One shot, one value every 2 ticks, the port keeps the last value */
+	HOST_TEST_CHECK(Dio_PlayPattern(PORTB_ID, OneShot, 3U, 2U, DIO_PATTERN_ONE_SHOT) == E_OK);
+	HOST_TEST_CHECK(Dio_GetPatternStatus(PORTB_ID) == DIO_PATTERN_PLAYING);
+	for (uint8 Tick = 0U; Tick < 6U; ++Tick) {
+		Dio_PatternTick();
+		HOST_TEST_CHECK(PORTB == OneShotPort[Tick]);
+	}
+	HOST_TEST_CHECK(Dio_GetPatternStatus(PORTB_ID) == DIO_PATTERN_IDLE);
+	HOST_TEST_CHECK(PORTA == 0x01U);
+	HOST_TEST_CHECK(PORTC == 0x07U);
+
+	/* Repeat until stopped */
+	HOST_TEST_CHECK(Dio_PlayPattern(PORTB_ID, First, 2U, 1U, DIO_PATTERN_REPEAT) == E_OK);
+	for (uint8 Tick = 0U; Tick < 5U; ++Tick) {
+		Dio_PatternTick();
+		HOST_TEST_CHECK(PORTB == First[Tick % 2U]);
+	}
+	Dio_StopPattern(PORTB_ID);
+	HOST_TEST_CHECK(Dio_GetPatternStatus(PORTB_ID) == DIO_PATTERN_IDLE);
+	Dio_PatternTick();
+	HOST_TEST_CHECK(PORTB == 0xA0U);
+
+	/* Double buffer: the queued buffer follows without a gap */
+	HOST_TEST_CHECK(Dio_PlayPattern(PORTB_ID, First, 2U, 1U, DIO_PATTERN_DOUBLE_BUFFER) == E_OK);
+	HOST_TEST_CHECK(Dio_GetPatternStatus(PORTB_ID) == DIO_PATTERN_QUEUE_FREE);
+	HOST_TEST_CHECK(Dio_QueuePattern(PORTB_ID, Second, 2U) == E_OK);
+	HOST_TEST_CHECK(Dio_GetPatternStatus(PORTB_ID) == DIO_PATTERN_PLAYING);
+	HOST_TEST_CHECK(Dio_QueuePattern(PORTB_ID, First, 2U) == E_NOT_OK);
+	Dio_PatternTick();
+	HOST_TEST_CHECK(PORTB == 0xA0U);
+	Dio_PatternTick();
+	HOST_TEST_CHECK(PORTB == 0xA1U);
+	HOST_TEST_CHECK(Dio_GetPatternStatus(PORTB_ID) == DIO_PATTERN_QUEUE_FREE);
+	Dio_PatternTick();
+	HOST_TEST_CHECK(PORTB == 0xB0U);
+	Dio_PatternTick();
+	HOST_TEST_CHECK(PORTB == 0xB1U);
+	HOST_TEST_CHECK(Dio_GetPatternStatus(PORTB_ID) == DIO_PATTERN_IDLE);
+
+	HOST_TEST_CHECK(Dio_PlayPattern(PORTB_ID, NULL_PTR, 2U, 1U, DIO_PATTERN_ONE_SHOT) == E_NOT_OK);
+	HOST_TEST_CHECK_DET(DIO_E_PARAM_POINTER);
+
+	Dio_WritePort(PORTB_ID, 0x00U);
+	HOST_TEST_CHECK(PORTB == 0x00U);
+#endif
+}
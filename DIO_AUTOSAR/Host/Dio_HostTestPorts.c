@@ -0,0 +1,53 @@
+/*======================================================================================================
+ * Module: DIO																							*
+ * File Name: Dio_HostTestPorts.c																		*
+ * Description: Host test of Dio_MaskedWritePort and Dio_SetupPortDirection								*
+ * Author: Mahmoud-Helmy																				*
+ *======================================================================================================*/
+/* =====================================================================================================
+ * 											   INCLUDES
+ * =====================================================================================================*/
+#include "Dio_HostTest.h"
+
+/* =====================================================================================================
+ * 											 TESTS
+ * =====================================================================================================*/
+void Dio_HostTestMaskedWrite(void) {
+#if (DIO_MASKED_WRITE_PORT_API == STD_ON)
+	/* Only the pins of the mask change */
+	Dio_WritePort(PORTB_ID, 0x5AU);
+	Dio_MaskedWritePort(PORTB_ID, 0xF0U, 0x3CU);
+	Dio_HostTestCommit();
+	HOST_TEST_CHECK(PORTB == 0x72U);
+
+	/* Empty and full masks */
+	Dio_MaskedWritePort(PORTB_ID, 0xFFU, 0x00U);
+	Dio_HostTestCommit();
+	HOST_TEST_CHECK(PORTB == 0x72U);
+	Dio_MaskedWritePort(PORTB_ID, 0x00U, 0xFFU);
+	Dio_HostTestCommit();
+	HOST_TEST_CHECK(PORTB == 0x00U);
+
+	Dio_MaskedWritePort((Dio_PortType)(PORTA_ID + DIO_CONFIGURED_PORTS), 0xFFU, 0xFFU);
+	HOST_TEST_CHECK_DET(DIO_E_PARAM_INVALID_PORT_ID);
+#endif
+}
+
+/* Whole port direction and level on every port of the device, last: leaves all the ports as inputs */
+void Dio_HostTestPortDirection(void) {
+	for (uint8 PortIndex = 0U; PortIndex < DIO_CONFIGURED_PORTS; ++PortIndex) {
+		Dio_PortType Port_Id = (Dio_PortType)(PORTA_ID + PortIndex);
+
+		Dio_SetupPortDirection(Port_Id, OUTPUT);
+		HOST_TEST_CHECK(*Dio_HostTestDdr[PortIndex] == 0xFFU);
+		Dio_WritePort(Port_Id, 0xA5U);
+		Dio_HostTestCommit();
+		HOST_TEST_CHECK(*Dio_HostTestPort[PortIndex] == 0xA5U);
+		HOST_TEST_CHECK(Dio_ReadPort(Port_Id) == 0xA5U);
+		Dio_SetupPortDirection(Port_Id, INPUT);
+		HOST_TEST_CHECK(*Dio_HostTestDdr[PortIndex] == 0x00U);
+	}
+
+	Dio_SetupPortDirection((Dio_PortType)(PORTA_ID + DIO_CONFIGURED_PORTS), OUTPUT);
+	HOST_TEST_CHECK_DET(DIO_E_PARAM_INVALID_PORT_ID);
+}
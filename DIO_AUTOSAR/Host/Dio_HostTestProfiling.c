@@ -0,0 +1,45 @@
+/*======================================================================================================
+ * Module: DIO																							*
+ * File Name: Dio_HostTestProfiling.c																	*
+ * Description: Host test of the service statistics (DIO_PROFILING)										*
+ * Author: Mahmoud-Helmy																				*
+ *======================================================================================================*/
+/* =====================================================================================================
+ * 											   INCLUDES
+ * =====================================================================================================*/
+#include "Dio_HostTest.h"
+
+/* =====================================================================================================
+ * 											 TESTS
+ * =====================================================================================================*/
+void Dio_HostTestProfiling(void) {
+#if (DIO_PROFILING == STD_ON)
+	Dio_ServiceStatisticsType Statistics;
+	uint16 Binned = 0U;
+
+	Dio_ResetStatistics();
+	Dio_WriteChannel(PORTC_ID, PIN2_ID, STD_HIGH);
+	Dio_WriteChannel(PORTC_ID, PIN2_ID, STD_HIGH);
+	Dio_WriteChannel(PORTC_ID, DIO_CONFIGURED_CHANNLES, STD_HIGH);
+	HOST_TEST_CHECK_DET(DIO_E_PARAM_INVALID_CHANNEL_ID);
+	HOST_TEST_CHECK(Dio_GetStatistics(DIO_WRITE_CHANNEL_SID, &Statistics) == E_OK);
+	HOST_TEST_CHECK(Statistics.Calls == 3U);
+	HOST_TEST_CHECK(Statistics.Errors == 1U);
+
+	/* Every call is in one bin of the histogram */
+	for (uint8 Bin = 0U; Bin < DIO_PROFILING_BINS; ++Bin) {
+		Binned += Statistics.Histogram[Bin];
+	}
+	HOST_TEST_CHECK(Binned == 3U);
+	HOST_TEST_CHECK(Dio_GetStatistics(DIO_READ_PORT_SID, &Statistics) == E_OK);
+	HOST_TEST_CHECK(Statistics.Calls == 0U);
+
+	Dio_ResetStatistics();
+	HOST_TEST_CHECK(Dio_GetStatistics(DIO_WRITE_CHANNEL_SID, &Statistics) == E_OK);
+	HOST_TEST_CHECK(Statistics.Calls == 0U);
+	HOST_TEST_CHECK(Statistics.MaxTicks == 0U);
+
+	HOST_TEST_CHECK(Dio_GetStatistics(DIO_PROFILING_SERVICES, &Statistics) == E_NOT_OK);
+	HOST_TEST_CHECK_DET(DIO_E_PARAM_CONFIG);
+#endif
+}
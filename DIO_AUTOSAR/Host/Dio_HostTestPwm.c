@@ -0,0 +1,65 @@
+/*======================================================================================================
+ * Module: DIO																							*
+ * File Name: Dio_HostTestPwm.c																			*
+ * Description: Host test of the software PWM (Dio_Pwm.c)												*
+ * Author: Mahmoud-Helmy																				*
+ *======================================================================================================*/
+/* =====================================================================================================
+ * 											   INCLUDES
+ * =====================================================================================================*/
+#include "Dio_HostTest.h"
+
+#if (DIO_PWM_API == STD_ON)
+#include "../Dio/Dio_Pwm.h"
+#endif
+
+/* =====================================================================================================
+ * 											 TESTS
+ * =====================================================================================================*/
+void Dio_HostTestPwm(void) {
+#if (DIO_PWM_API == STD_ON)
+	uint16 OnTicks[2] = { 0U, 0U };
+	uint16 PeriodTicks = 0U;
+	uint8 PortC = PORTC;
+
+	Dio_PwmInit(HOST_TEST_CHANNEL(PIN_A_4) | HOST_TEST_CHANNEL(PIN_A_5));
+	HOST_TEST_CHECK(Dio_PwmSetDuty(PIN_A_4, 0x81U) == E_OK);
+	HOST_TEST_CHECK(Dio_PwmSetDuty(PIN_A_5, DIO_PWM_MAX_DUTY) == E_OK);
+	HOST_TEST_CHECK(Dio_PwmSetDuty(PIN_A_3, 0x10U) == E_NOT_OK);
+	HOST_TEST_CHECK_DET(DIO_E_PARAM_INVALID_CHANNEL_ID);
+	Dio_PwmUpdate();
+
+	/* First period (DIO_PWM_MAX_DUTY base ticks): the update is applied at its end */
+	while (PeriodTicks < DIO_PWM_MAX_DUTY) {
+		PeriodTicks += Dio_PwmTick();
+		HOST_TEST_CHECK((PORTA & 0x30U) == 0x00U);
+	}
+
+	/* Second period: each pin is high for its duty in base ticks, the other pins keep their level */
+	PeriodTicks = 0U;
+	while (PeriodTicks < DIO_PWM_MAX_DUTY) {
+		uint8 Weight = Dio_PwmTick();
+
+		OnTicks[0] += ((PORTA & 0x10U) != 0U) ? Weight : 0U;
+		OnTicks[1] += ((PORTA & 0x20U) != 0U) ? Weight : 0U;
+		PeriodTicks += Weight;
+		HOST_TEST_CHECK((PORTA & 0xCFU) == 0x01U);
+		HOST_TEST_CHECK(PORTC == PortC);
+	}
+	HOST_TEST_CHECK(PeriodTicks == DIO_PWM_MAX_DUTY);
+	HOST_TEST_CHECK(OnTicks[0] == 0x81U);
+	HOST_TEST_CHECK(OnTicks[1] == DIO_PWM_MAX_DUTY);
+
+	/* Duty 0 on both channels */
+	HOST_TEST_CHECK(Dio_PwmSetDuty(PIN_A_4, 0U) == E_OK);
+	HOST_TEST_CHECK(Dio_PwmSetDuty(PIN_A_5, 0U) == E_OK);
+	Dio_PwmUpdate();
+	for (uint8 Period = 0U; Period < 2U; ++Period) {
+		PeriodTicks = 0U;
+		while (PeriodTicks < DIO_PWM_MAX_DUTY) {
+			PeriodTicks += Dio_PwmTick();
+		}
+	}
+	HOST_TEST_CHECK(PORTA == 0x01U);
+#endif
+}
@@ -0,0 +1,34 @@
+/*======================================================================================================
+ * Module: DIO																							*
+ * File Name: Dio_HostTestSampling.c																	*
+ * Description: Host test of the input snapshot (Dio_SampleInputs / Dio_ReadSampledChannel)				*
+ * Author: Mahmoud-Helmy																				*
+ *======================================================================================================*/
+/* =====================================================================================================
+ * 											   INCLUDES
+ * =====================================================================================================*/
+#include "Dio_HostTest.h"
+
+/* =====================================================================================================
+ * 											 TESTS
+ * =====================================================================================================*/
+void Dio_HostTestSampling(void) {
+	Dio_ChannelsLevelType Snapshot;
+
+	/* Outputs sampled with their latch, inputs with the external level */
+	Dio_HostSetInputs(PORTD_ID, 0x50U);
+	Snapshot = Dio_SampleInputs();
+	HOST_TEST_CHECK(Snapshot == 0x50070001UL);
+
+	/* The snapshot keeps the level of the sampling instant */
+	Dio_HostSetInputs(PORTD_ID, 0x00U);
+	HOST_TEST_CHECK(Dio_ReadSampledChannel(PIN_D_4) == STD_HIGH);
+	HOST_TEST_CHECK(Dio_ReadSampledChannel(PIN_D_5) == STD_LOW);
+	HOST_TEST_CHECK(Dio_ReadChannel(PORTD_ID, PIN4_ID) == STD_LOW);
+
+	(void)Dio_SampleInputs();
+	HOST_TEST_CHECK(Dio_ReadSampledChannel(PIN_D_4) == STD_LOW);
+
+	(void)Dio_ReadSampledChannel(DIO_IMAGE_CHANNELS);
+	HOST_TEST_CHECK_DET(DIO_E_PARAM_INVALID_CHANNEL_ID);
+}
@@ -0,0 +1,43 @@
+/*======================================================================================================
+ * Module: DIO																							*
+ * File Name: Dio_HostTestTrace.c																		*
+ * Description: Host test of the register write trace (Dio_Trace.c)										*
+ * Author: Mahmoud-Helmy																				*
+ *======================================================================================================*/
+/* =====================================================================================================
+ * 											   INCLUDES
+ * =====================================================================================================*/
+#include "Dio_HostTest.h"
+
+#if (DIO_TRACE == STD_ON)
+#include "../Dio/Dio_Trace.h"
+#endif
+
+/* =====================================================================================================
+ * 											 TESTS
+ * =====================================================================================================*/
+void Dio_HostTestTrace(void) {
+#if (DIO_TRACE == STD_ON)
+	Dio_TraceRecordType Records[4];
+
+	Dio_ClearTrace();
+	Dio_WriteChannel(PORTC_ID, PIN2_ID, STD_LOW);
+	Dio_HostTestCommit();
+	HOST_TEST_CHECK(Dio_GetTrace(Records, 4U) == 1U);
+	HOST_TEST_CHECK(Records[0].Address == (uint8)DIO_REG_ADDRESS(&PORTC));
+	HOST_TEST_CHECK(Records[0].Old == 0x07U);
+	HOST_TEST_CHECK(Records[0].New == 0x03U);
+
+	/* Ports not written since the last commit are not written again */
+	Dio_ClearTrace();
+	Dio_HostTestCommit();
+	HOST_TEST_CHECK(Dio_GetTrace(Records, 4U) == 0U);
+
+	Dio_WriteChannel(PORTC_ID, PIN2_ID, STD_HIGH);
+	Dio_HostTestCommit();
+	HOST_TEST_CHECK(PORTC == 0x07U);
+
+	HOST_TEST_CHECK(Dio_GetTrace(NULL_PTR, 4U) == 0U);
+	HOST_TEST_CHECK_DET(DIO_E_PARAM_POINTER);
+#endif
+}
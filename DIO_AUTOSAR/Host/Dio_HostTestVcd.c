@@ -0,0 +1,73 @@
+/*======================================================================================================
+ * Module: DIO																							*
+ * File Name: Dio_HostTestVcd.c																			*
+ * Description: Host test of the Value Change Dump of the host backend (Dio_HostVcd.c)					*
+ * Author: Mahmoud-Helmy																				*
+ *======================================================================================================*/
+/* =====================================================================================================
+ * 											   INCLUDES
+ * =====================================================================================================*/
+#include "Dio_HostTest.h"
+
+#include <string.h>
+
+/* =====================================================================================================
+ * 											 TESTS
+ * =====================================================================================================*/
+/* Dump written by the test, next to the test binary (set by Host/Makefile) */
+#ifndef HOST_TEST_VCD_PATH
+#define HOST_TEST_VCD_PATH             "dio_test.vcd"
+#endif
+
+/* Largest dump of the test: definitions of the 88 pins of the ATmega2560 and a few changes */
+#define HOST_TEST_VCD_MAX_SIZE         (16384U)
+
+/* Reads the whole dump written by Dio_HostVcdClose, NUL terminated */
+STATIC uint32 Dio_HostTestReadDump(char *Text, uint32 Size) {
+	uint32 Length = 0U;
+	FILE *File = fopen(HOST_TEST_VCD_PATH, "rb");
+
+	if (NULL_PTR != File) {
+		Length = (uint32)fread(Text, 1U, Size - 1U, File);
+		(void)fclose(File);
+	} else {
+		/* Do Nothing */
+	}
+	Text[Length] = '\0';
+	return Length;
+}
+
+void Dio_HostTestVcd(void) {
+	static char Text[HOST_TEST_VCD_MAX_SIZE];
+	/* Changes of PIN_C_2 (id '3' = '!' + PIN_C_2) and of PORTC (id "{C") after the initial values */
+	static const char Changes[] = "#100\n03\nb00000011 {C\n#150\n13\nb00000111 {C\n";
+	uint32 Length;
+
+	HOST_TEST_CHECK(Dio_HostVcdOpen(HOST_TEST_VCD_PATH) == E_OK);
+
+	/* One time stamp per time step with changes, rewrites of the same level are not dumped */
+	Dio_HostAdvanceTime(100U);
+	Dio_WriteChannel(PORTC_ID, PIN2_ID, STD_LOW);
+	Dio_HostTestCommit();
+	Dio_WriteChannel(PORTC_ID, PIN2_ID, STD_LOW);
+	Dio_HostTestCommit();
+	Dio_HostAdvanceTime(50U);
+	Dio_WriteChannel(PORTC_ID, PIN2_ID, STD_HIGH);
+	Dio_HostTestCommit();
+	Dio_HostVcdClose();
+
+	/* Writes after the close are not dumped */
+	Dio_WriteChannel(PORTC_ID, PIN2_ID, STD_LOW);
+	Dio_WriteChannel(PORTC_ID, PIN2_ID, STD_HIGH);
+	Dio_HostTestCommit();
+
+	Length = Dio_HostTestReadDump(Text, HOST_TEST_VCD_MAX_SIZE);
+	HOST_TEST_CHECK(strstr(Text, "$var wire 1 3 PIN_C_2 $end\n") != NULL_PTR);
+	HOST_TEST_CHECK(strstr(Text, "$var reg 8 {C PORTC $end\n") != NULL_PTR);
+	HOST_TEST_CHECK(strstr(Text, "$enddefinitions $end\n#0\n$dumpvars\n") != NULL_PTR);
+	HOST_TEST_CHECK(strstr(Text, "b00000111 {C\n") != NULL_PTR);
+	HOST_TEST_CHECK(Length >= (sizeof(Changes) - 1U));
+	HOST_TEST_CHECK(strcmp(&Text[Length - (sizeof(Changes) - 1U)], Changes) == 0);
+
+	HOST_TEST_CHECK(Dio_HostVcdOpen("") == E_NOT_OK);
+}
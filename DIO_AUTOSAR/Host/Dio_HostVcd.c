@@ -0,0 +1,270 @@
+/*======================================================================================================
+ * Module: DIO																							*
+ * File Name: Dio_HostVcd.c																				*
+ * Description: Value Change Dump of the simulated DIO registers (host backend)							*
+ * Author: Mahmoud-Helmy																				*
+ *======================================================================================================*/
+/* =====================================================================================================
+ * 											   INCLUDES
+ * =====================================================================================================*/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "Dio_Host.h"
+#include "../Dio/MemMap.h"
+
+#if !defined(DIO_HOST_BACKEND)
+  #error "Dio_HostVcd.c is only part of the host build (DIO_HOST_BACKEND)"
+#endif
+
+/* =====================================================================================================
+ * 										   DEFINITIONS
+ * =====================================================================================================*/
+/* Output buffer, written to the file in whole blocks */
+#define DIO_HOST_VCD_BUFFER_SIZE       (1UL << 20)
+
+/* Longest output of one port update: time stamp, 8 pins and 2 registers */
+#define DIO_HOST_VCD_MAX_UPDATE        (128U)
+
+/* Identifier codes of the signals: one printable character per pin ('!' .. 'x' for the 88 pins
+ * of the largest device), two for the registers: '{' / '}' followed by the port letter */
+#define DIO_HOST_VCD_PIN_ID(INDEX)     ((char)('!' + (INDEX)))
+#define DIO_HOST_VCD_PORT_ID           '{'
+#define DIO_HOST_VCD_DDR_ID            '}'
+
+/* Port letters of the device, "ABCD" on the ATmega32 */
+#define DIO_HOST_VCD_LETTER(ARG, L)    #L
+
+/* Last dumped state of a port */
+typedef struct Dio_HostVcdPortType {
+	uint8 Port;
+	uint8 Ddr;
+	uint8 Pin;
+} Dio_HostVcdPortType;
+
+/* =====================================================================================================
+ * 							                GLOBAL VARIABLES
+ * =====================================================================================================*/
+/* Dump file, NULL while no dump is running */
+STATIC FILE *Dio_HostVcdFile = NULL_PTR;
+
+STATIC char Dio_HostVcdBuffer[DIO_HOST_VCD_BUFFER_SIZE];
+STATIC uint32 Dio_HostVcdFill = 0U;
+
+/* Simulation time (ns) and time of the last time stamp written to the dump */
+STATIC uint64 Dio_HostVcdNow = 0U;
+STATIC uint64 Dio_HostVcdStamp = 0U;
+
+STATIC Dio_HostVcdPortType Dio_HostVcdLast[DIO_CONFIGURED_PORTS];
+
+/* Registers of each port of the device, indexed by (Port_Id - PORTA_ID) */
+STATIC volatile uint8 * const Dio_HostVcdPorts[DIO_CONFIGURED_PORTS] = { DIO_DEVICE_PORTS(DIO_DEVICE_REG_ENTRY, PORT) };
+STATIC volatile uint8 * const Dio_HostVcdPins[DIO_CONFIGURED_PORTS]  = { DIO_DEVICE_PORTS(DIO_DEVICE_REG_ENTRY, PIN) };
+STATIC volatile uint8 * const Dio_HostVcdDdrs[DIO_CONFIGURED_PORTS]  = { DIO_DEVICE_PORTS(DIO_DEVICE_REG_ENTRY, DDR) };
+
+STATIC const char Dio_HostVcdLetters[] = DIO_DEVICE_PORTS(DIO_HOST_VCD_LETTER, ~);
+
+/* =====================================================================================================
+ * 										   LOCAL FUNCTIONS
+ * =====================================================================================================*/
+/* Writes the buffered output to the file */
+STATIC void flushBuffer(void) {
+	if (0U != Dio_HostVcdFill) {
+		(void)fwrite(Dio_HostVcdBuffer, 1U, Dio_HostVcdFill, Dio_HostVcdFile);
+		Dio_HostVcdFill = 0U;
+	} else {
+		/* Do Nothing */
+	}
+}
+
+/* Makes room for the output of one port update, or a header line */
+STATIC void reserveBuffer(void) {
+	if ((DIO_HOST_VCD_BUFFER_SIZE - Dio_HostVcdFill) < DIO_HOST_VCD_MAX_UPDATE) {
+		flushBuffer();
+	} else {
+		/* No Action Required */
+	}
+}
+
+STATIC void putText(const char *Text) {
+	while ('\0' != *Text) {
+		Dio_HostVcdBuffer[Dio_HostVcdFill++] = *Text++;
+	}
+}
+
+/* "#<Time>\n", without snprintf: it is written for most of the updates */
+STATIC void putTime(uint64 Time) {
+	char Digits[20];
+	uint8 Count = 0U;
+
+	do {
+		Digits[Count++] = (char)('0' + (Time % 10U));
+		Time /= 10U;
+	} while (0U != Time);
+
+	Dio_HostVcdBuffer[Dio_HostVcdFill++] = '#';
+	while (0U != Count) {
+		Dio_HostVcdBuffer[Dio_HostVcdFill++] = Digits[--Count];
+	}
+	Dio_HostVcdBuffer[Dio_HostVcdFill++] = '\n';
+}
+
+/* "<0|1><Id>\n" */
+STATIC void putBit(uint8 Value, char Id) {
+	Dio_HostVcdBuffer[Dio_HostVcdFill++] = (0U != Value) ? '1' : '0';
+	Dio_HostVcdBuffer[Dio_HostVcdFill++] = Id;
+	Dio_HostVcdBuffer[Dio_HostVcdFill++] = '\n';
+}
+
+/* "b<8 bits> <Prefix><Letter of the port>\n" */
+STATIC void putByte(uint8 Value, char Prefix, uint8 PortIndex) {
+	Dio_HostVcdBuffer[Dio_HostVcdFill++] = 'b';
+	for (uint8 Bit = NUM_OF_PINS_IN_SINGLE_PORT; 0U != Bit; --Bit) {
+		Dio_HostVcdBuffer[Dio_HostVcdFill++] = (0U != (Value & (uint8)(1U << (Bit - 1U)))) ? '1' : '0';
+	}
+	Dio_HostVcdBuffer[Dio_HostVcdFill++] = ' ';
+	Dio_HostVcdBuffer[Dio_HostVcdFill++] = Prefix;
+	Dio_HostVcdBuffer[Dio_HostVcdFill++] = Dio_HostVcdLetters[PortIndex];
+	Dio_HostVcdBuffer[Dio_HostVcdFill++] = '\n';
+}
+
+/* $var line of one signal */
+STATIC void putVar(uint8 Width, const char *Id, const char *Name) {
+	reserveBuffer();
+	putText(1U == Width ? "$var wire 1 " : "$var reg 8 ");
+	putText(Id);
+	Dio_HostVcdBuffer[Dio_HostVcdFill++] = ' ';
+	putText(Name);
+	putText(" $end\n");
+}
+
+/* =====================================================================================================
+ * 												 APIs
+ * =====================================================================================================*/
+Std_ReturnType Dio_HostVcdOpen(const char *Path) {
+	Std_ReturnType output = E_NOT_OK;
+	STATIC boolean AtExit = FALSE;
+
+	Dio_HostVcdClose();
+	Dio_HostVcdFile = fopen(Path, "wb");
+	if (NULL_PTR != Dio_HostVcdFile) {
+		char Name[8] = "PIN_A_0";
+
+		/* The blocks are already large, no second copy in stdio */
+		(void)setvbuf(Dio_HostVcdFile, NULL_PTR, _IONBF, 0U);
+		if (FALSE == AtExit) {
+			/* A dump left open by the test bench is still complete */
+			(void)atexit(Dio_HostVcdClose);
+			AtExit = TRUE;
+		} else {
+			/* No Action Required */
+		}
+
+		Dio_HostVcdFill = 0U;
+		putText("$version DIO host backend $end\n$timescale 1ns $end\n$scope module " DIO_DEVICE_NAME " $end\n");
+		putText("$scope module pins $end\n");
+		for (uint8 Index = 0U; Index < (DIO_CONFIGURED_PORTS * NUM_OF_PINS_IN_SINGLE_PORT); ++Index) {
+			char Id[2] = { DIO_HOST_VCD_PIN_ID(Index), '\0' };
+
+			Name[4] = Dio_HostVcdLetters[Index / NUM_OF_PINS_IN_SINGLE_PORT];
+			Name[6] = (char)('0' + (Index % NUM_OF_PINS_IN_SINGLE_PORT));
+			putVar(1U, Id, Name);
+		}
+		putText("$upscope $end\n$scope module registers $end\n");
+		for (uint8 PortIndex = 0U; PortIndex < DIO_CONFIGURED_PORTS; ++PortIndex) {
+			char PortName[6] = "PORTA";
+			char DdrName[5] = "DDRA";
+			char PortId[3] = { DIO_HOST_VCD_PORT_ID, Dio_HostVcdLetters[PortIndex], '\0' };
+			char DdrId[3] = { DIO_HOST_VCD_DDR_ID, Dio_HostVcdLetters[PortIndex], '\0' };
+
+			PortName[4] = Dio_HostVcdLetters[PortIndex];
+			DdrName[3] = Dio_HostVcdLetters[PortIndex];
+			putVar(8U, PortId, PortName);
+			putVar(8U, DdrId, DdrName);
+		}
+		putText("$upscope $end\n$upscope $end\n$enddefinitions $end\n");
+
+		/* Initial values of all the signals */
+		putTime(Dio_HostVcdNow);
+		Dio_HostVcdStamp = Dio_HostVcdNow;
+		putText("$dumpvars\n");
+		for (uint8 PortIndex = 0U; PortIndex < DIO_CONFIGURED_PORTS; ++PortIndex) {
+			Dio_HostVcdPortType *Last = &Dio_HostVcdLast[PortIndex];
+
+			reserveBuffer();
+			Last->Port = *Dio_HostVcdPorts[PortIndex];
+			Last->Ddr = *Dio_HostVcdDdrs[PortIndex];
+			Last->Pin = Dio_HostRead(Dio_HostVcdPins[PortIndex]);
+			for (uint8 Bit = 0U; Bit < NUM_OF_PINS_IN_SINGLE_PORT; ++Bit) {
+				putBit((uint8)(Last->Pin & (1U << Bit)), DIO_HOST_VCD_PIN_ID((PortIndex * NUM_OF_PINS_IN_SINGLE_PORT) + Bit));
+			}
+			putByte(Last->Port, DIO_HOST_VCD_PORT_ID, PortIndex);
+			putByte(Last->Ddr, DIO_HOST_VCD_DDR_ID, PortIndex);
+		}
+		putText("$end\n");
+
+		output = E_OK;
+	} else {
+		/* Do Nothing */
+	}
+	return output;
+}
+
+void Dio_HostVcdClose(void) {
+	if (NULL_PTR != Dio_HostVcdFile) {
+		flushBuffer();
+		(void)fclose(Dio_HostVcdFile);
+		Dio_HostVcdFile = NULL_PTR;
+	} else {
+		/* Do Nothing */
+	}
+}
+
+void Dio_HostAdvanceTime(uint32 Ns) {
+	Dio_HostVcdNow += Ns;
+}
+
+void Dio_HostVcdPort(uint8 PortIndex) {
+	if (NULL_PTR != Dio_HostVcdFile) {
+		Dio_HostVcdPortType *Last = &Dio_HostVcdLast[PortIndex];
+		uint8 Port = *Dio_HostVcdPorts[PortIndex];
+		uint8 Ddr = *Dio_HostVcdDdrs[PortIndex];
+		uint8 Pin = Dio_HostRead(Dio_HostVcdPins[PortIndex]);
+		uint8 Changed = (uint8)(Pin ^ Last->Pin);
+
+		/* Rewrites of the same value are not changes */
+		if ((0U != Changed) || (Port != Last->Port) || (Ddr != Last->Ddr)) {
+			reserveBuffer();
+			if (Dio_HostVcdStamp != Dio_HostVcdNow) {
+				putTime(Dio_HostVcdNow);
+				Dio_HostVcdStamp = Dio_HostVcdNow;
+			} else {
+				/* Same time step as the previous change */
+			}
+			for (uint8 Bit = 0U; 0U != Changed; ++Bit, Changed >>= 1) {
+				if (0U != (Changed & 1U)) {
+					putBit((uint8)(Pin & (1U << Bit)), DIO_HOST_VCD_PIN_ID((PortIndex * NUM_OF_PINS_IN_SINGLE_PORT) + Bit));
+				} else {
+					/* Do Nothing */
+				}
+			}
+			if (Port != Last->Port) {
+				putByte(Port, DIO_HOST_VCD_PORT_ID, PortIndex);
+			} else {
+				/* Do Nothing */
+			}
+			if (Ddr != Last->Ddr) {
+				putByte(Ddr, DIO_HOST_VCD_DDR_ID, PortIndex);
+			} else {
+				/* Do Nothing */
+			}
+			Last->Port = Port;
+			Last->Ddr = Ddr;
+			Last->Pin = Pin;
+		} else {
+			/* Do Nothing */
+		}
+	} else {
+		/* Do Nothing */
+	}
+}
@@ -43,7 +43,17 @@
 /* This is used to define the local inline function */
 #define LOCAL_INLINE      static inline
 
+/* This is used to define a local inline function that is inlined even without optimization hints */
+#define FORCE_INLINE      static inline __attribute__((always_inline))
+
 /* This is used to define the abstraction of compiler keyword static */
 #define STATIC            static
 
+/* This is used to place constant tables in program memory (AVR named address space) */
+#if defined(__AVR__) && !defined(__cplusplus)
+#define FLASH             __flash
+#else
+#define FLASH
+#endif
+
 #endif
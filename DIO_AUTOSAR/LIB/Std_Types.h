@@ -10,7 +10,7 @@
 #define STD_TYPES_H
 
 
-# include "Platform_Types.h"
+# include "platform_types.h"
 # include "Compiler.h"
 
 